@@ -13,7 +13,8 @@
 
 class Game : public Runa::Application {
 public:
-    Game() : Application("Runa2 Game", 2560, 1440) {}
+    explicit Game(const Runa::ApplicationOptions& options)
+        : Application("Runa2 Game", 2560, 1440, options) {}
 
 protected:
     void onInit() override {
@@ -31,7 +32,7 @@ int main(int argc, char* argv[]) {
         Runa::Log::init();
         LOG_INFO("Starting Runa2 Game...");
 
-        auto game = std::make_unique<Game>();
+        auto game = std::make_unique<Game>(Runa::ApplicationOptions::parse(argc, argv));
         game->run();
 
         LOG_INFO("Game exited successfully");
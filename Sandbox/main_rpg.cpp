@@ -9,6 +9,9 @@
 #include "Core/Application.h"
 #include "Core/InputManager.h"
 #include "Core/Log.h"
+#include "Core/Random.h"
+#include "ECS/Prefab.h"
+#include "ECS/QuestTracker.h"
 #include "ECS/RPGComponents.h"
 #include "ECS/RPGSystems.h"
 #include "ECS/Registry.h"
@@ -19,27 +22,31 @@
 #include "Graphics/Texture.h"
 #include "Graphics/TileMap.h"
 #include "runapch.h"
-#include <cstdlib>
-#include <ctime>
 #include <memory>
 
 class RunaRPG : public Runa::Application {
 public:
-  RunaRPG() : Application("Runa", 1280, 720) {}
+  explicit RunaRPG(const Runa::ApplicationOptions &options)
+      : Application("Runa", 1280, 720, options) {}
 
 protected:
   void onInit() override {
     LOG_INFO("=== Runa RPG ===");
-    srand(static_cast<unsigned>(time(nullptr)));
 
 
     m_registry = std::make_unique<Runa::ECS::EntityRegistry>();
+    Runa::ECS::QuestTracker::get(m_registry->getRegistry());
+    Runa::ECS::ItemDatabase::loadFromFile("Resources/items.yaml");
+    m_potionId = Runa::ECS::ItemDatabase::findId("health_potion");
+    m_coinId = Runa::ECS::ItemDatabase::findId("gold_coin");
+    loadPrefabs();
     m_spriteBatch = std::make_unique<Runa::SpriteBatch>(getRenderer());
     m_font = std::make_unique<Runa::Font>(getRenderer(),
                                           "Resources/Fonts/Renogare.ttf", 20);
     m_camera = std::make_unique<Runa::Camera>(getWindow());
     m_inputManager = std::make_unique<Runa::InputManager>(getInput());
     m_inputManager->initialize();
+    getInputRecorder().attach(m_inputManager.get());
 
 
     unsigned char whitePixel[4] = {255, 255, 255, 255};
@@ -62,15 +69,11 @@ protected:
     }
 
 
-    for (int i = 0; i < 8; ++i) {
-      spawnSlime();
-    }
+    spawnSlimes(8);
 
 
-    for (int i = 0; i < 10; ++i) {
-      spawnPotion();
-      spawnCoin();
-    }
+    spawnPickups(m_potionPrefab, 10);
+    spawnPickups(m_coinPrefab, 10);
 
 
     createQuestGiver();
@@ -118,8 +121,8 @@ protected:
 
 
     for (int i = 0; i < 20; ++i) {
-      int x = 10 + (rand() % 30);
-      int y = 10 + (rand() % 30);
+      int x = Runa::Random::game().range(10, 39);
+      int y = Runa::Random::game().range(10, 39);
       m_tileMap->setTile(x, y, 3);
       m_tileMap->setSolidTile(3, true);
     }
@@ -172,98 +175,48 @@ protected:
     reg.emplace<Runa::ECS::PlayerInput>(m_player, 150.0f);
   }
 
-  void spawnSlime() {
-
-    float x = (10 + (rand() % 30)) * 32.0f;
-    float y = (10 + (rand() % 30)) * 32.0f;
-
-    auto slime = m_registry->createEntity(x, y);
-    auto &reg = m_registry->getRegistry();
-
-    reg.emplace<Runa::ECS::Enemy>(slime);
-    reg.emplace<Runa::ECS::Velocity>(slime, 0.0f, 0.0f);
-    reg.emplace<Runa::ECS::Size>(slime, 28.0f, 28.0f);
-    reg.emplace<Runa::ECS::AABB>(slime, 28.0f, 28.0f);
-
-
-    auto &sprite = reg.emplace<Runa::ECS::Sprite>(slime);
-    sprite.spriteSheet = nullptr;
-    sprite.tintR = 0.2f;
-    sprite.tintG = 0.8f;
-    sprite.tintB = 0.2f;
-    sprite.tintA = 1.0f;
-
+  void loadPrefabs() {
+    Runa::ECS::PrefabLibrary::loadFromFile("Resources/prefabs.yaml");
 
-    auto &health = reg.emplace<Runa::ECS::Health>(slime);
-    health.current = 30.0f;
-    health.max = 30.0f;
+    m_slimePrefab = Runa::ECS::PrefabLibrary::get("slime");
 
 
-    auto &combat = reg.emplace<Runa::ECS::Combat>(slime);
-    combat.damage = 5.0f;
-    combat.attackRange = 30.0f;
-    combat.attackCooldown = 1.5f;
-
-
-    auto &ai = reg.emplace<Runa::ECS::AIController>(slime);
-    ai.state = Runa::ECS::AIState::Patrol;
-    ai.detectionRange = 180.0f;
-    ai.attackRange = 30.0f;
-    ai.moveSpeed = 100.0f;
+    if (auto *potion = Runa::ECS::PrefabLibrary::getMutable("health_potion_pickup")) {
+      potion->set<Runa::ECS::DroppedItem>({{m_potionId, 1}, false});
+      m_potionPrefab = potion;
+    }
+    if (auto *coin = Runa::ECS::PrefabLibrary::getMutable("gold_coin_pickup")) {
+      coin->set<Runa::ECS::DroppedItem>({{m_coinId, 1}, false});
+      m_coinPrefab = coin;
+    }
   }
 
-  void spawnPotion() {
-    float x = (5 + (rand() % 40)) * 32.0f;
-    float y = (5 + (rand() % 40)) * 32.0f;
-
-    auto item = m_registry->createEntity(x, y);
-    auto &reg = m_registry->getRegistry();
-
-    reg.emplace<Runa::ECS::ItemEntity>(item);
-    reg.emplace<Runa::ECS::Size>(item, 16.0f, 16.0f);
-
-
-    auto &sprite = reg.emplace<Runa::ECS::Sprite>(item);
-    sprite.spriteSheet = nullptr;
-    sprite.tintR = 1.0f;
-    sprite.tintG = 0.2f;
-    sprite.tintB = 0.2f;
-    sprite.tintA = 1.0f;
+  void spawnSlimes(int count) {
+    if (!m_slimePrefab || count <= 0) {
+      return;
+    }
 
+    std::vector<Runa::ECS::Position> positions(count);
+    for (auto &pos : positions) {
+      pos.x = Runa::Random::game().range(10, 39) * 32.0f;
+      pos.y = Runa::Random::game().range(10, 39) * 32.0f;
+    }
 
-    auto &droppedItem = reg.emplace<Runa::ECS::DroppedItem>(item);
-    droppedItem.item.type = Runa::ECS::ItemType::Potion;
-    droppedItem.item.name = "Health Potion";
-    droppedItem.item.description = "Restores 30 HP";
-    droppedItem.item.healAmount = 30.0f;
-    droppedItem.item.value = 10;
-    droppedItem.collected = false;
+    m_slimePrefab->instantiate(m_registry->getRegistry(), positions.size(), positions);
   }
 
-  void spawnCoin() {
-    float x = (5 + (rand() % 40)) * 32.0f;
-    float y = (5 + (rand() % 40)) * 32.0f;
-
-    auto item = m_registry->createEntity(x, y);
-    auto &reg = m_registry->getRegistry();
-
-    reg.emplace<Runa::ECS::ItemEntity>(item);
-    reg.emplace<Runa::ECS::Size>(item, 12.0f, 12.0f);
-
-
-    auto &sprite = reg.emplace<Runa::ECS::Sprite>(item);
-    sprite.spriteSheet = nullptr;
-    sprite.tintR = 1.0f;
-    sprite.tintG = 0.9f;
-    sprite.tintB = 0.0f;
-    sprite.tintA = 1.0f;
+  void spawnPickups(const Runa::ECS::Prefab *prefab, int count) {
+    if (!prefab || count <= 0) {
+      return;
+    }
 
+    std::vector<Runa::ECS::Position> positions(count);
+    for (auto &pos : positions) {
+      pos.x = Runa::Random::game().range(5, 44) * 32.0f;
+      pos.y = Runa::Random::game().range(5, 44) * 32.0f;
+    }
 
-    auto &droppedItem = reg.emplace<Runa::ECS::DroppedItem>(item);
-    droppedItem.item.type = Runa::ECS::ItemType::Coin;
-    droppedItem.item.name = "Gold Coin";
-    droppedItem.item.value = 5;
-    droppedItem.collected = false;
+    prefab->instantiate(m_registry->getRegistry(), positions.size(), positions);
   }
 
   void createQuestGiver() {
@@ -286,24 +239,26 @@ protected:
 
 
     auto &questGiver = reg.emplace<Runa::ECS::QuestGiver>(npc);
-    questGiver.npcName = "Village Elder";
-    questGiver.dialogueText = "Please help us! Defeat 5 slimes!";
-    questGiver.quest.id = "slime_hunter";
-    questGiver.quest.title = "Slime Infestation";
-    questGiver.quest.description =
-        "The village is under attack! Defeat 5 slimes.";
+    questGiver.npcName = Runa::StringPool::intern("Village Elder");
+    questGiver.dialogueText =
+        Runa::StringPool::intern("Please help us! Defeat 5 slimes!");
+    questGiver.quest.id = Runa::StringPool::intern("slime_hunter");
+    questGiver.quest.title = Runa::StringPool::intern("Slime Infestation");
+    questGiver.quest.description = Runa::StringPool::intern(
+        "The village is under attack! Defeat 5 slimes.");
     questGiver.quest.status = Runa::ECS::QuestStatus::NotStarted;
-    questGiver.quest.enemiesRequired = 5;
-    questGiver.quest.enemiesKilled = 0;
+    questGiver.quest.addObjective(Runa::ECS::QuestObjectiveType::Kill, "slime", 5);
     questGiver.quest.xpReward = 200;
     questGiver.quest.goldReward = 100;
   }
 
   void onUpdate(float dt) override {
+    m_inputManager->beginFrame();
     m_gameTime += dt;
 
 
     auto &reg = m_registry->getRegistry();
+    Runa::ECS::Systems::storePreviousPositions(reg);
     if (reg.valid(m_player) && reg.all_of<Runa::ECS::PlayerInput>(m_player)) {
       float moveX = m_inputManager->getActionAxisX("Move");
       float moveY = m_inputManager->getActionAxisY("Move");
@@ -340,9 +295,9 @@ protected:
 
           if (dist < 80.0f) {
             auto &questGiver = questView.get<Runa::ECS::QuestGiver>(npc);
-            if (questGiver.quest.status == Runa::ECS::QuestStatus::NotStarted) {
-              questGiver.quest.status = Runa::ECS::QuestStatus::InProgress;
-              LOG_INFO("Quest started: {}", questGiver.quest.title);
+            if (Runa::ECS::QuestTracker::get(reg).startQuest(reg, npc)) {
+              LOG_INFO("Quest started: {}",
+                       Runa::StringPool::lookup(questGiver.quest.title));
               m_showQuestText = true;
               m_questTextTimer = 3.0f;
             } else if (questGiver.quest.status ==
@@ -375,12 +330,7 @@ protected:
     Runa::ECS::RPGSystems::updateItemCollection(reg);
     Runa::ECS::RPGSystems::updateQuests(reg);
     Runa::ECS::RPGSystems::updateDamageNumbers(reg, dt);
-
-
-    if (reg.valid(m_player)) {
-      m_camera->followEntity(reg, m_player, 0.1f);
-    }
-    m_camera->update(dt);
+    Runa::ECS::RPGSystems::updateDamageFlashes(reg, dt);
 
 
     if (reg.valid(m_player) && reg.all_of<Runa::ECS::Health>(m_player)) {
@@ -398,23 +348,33 @@ protected:
       enemyCount++;
     }
     if (enemyCount < 3) {
-      spawnSlime();
+      spawnSlimes(1);
     }
   }
 
   void onRender() override {
     getRenderer().clear(0.05f, 0.1f, 0.05f, 1.0f);
 
-    m_spriteBatch->begin();
+    // Follow the player at its interpolated position, so the world moves with
+    // the display rate instead of stepping once per fixed tick
+    const float alpha = getInterpolationAlpha();
+    Runa::ECS::Systems::updateCameraFollow(m_registry->getRegistry(), *m_camera, 0.0f, alpha);
 
+    // Sorted world-space batch: tiles underneath, entities Y-sorted, all moved
+    // by the camera on the GPU
+    m_spriteBatch->begin(Runa::SpriteBatch::SortMode::Sorted, m_camera.get());
 
+    m_spriteBatch->setLayer(Runa::SpriteBatch::LAYER_GROUND, 0.0f);
     renderWorld();
 
-
+    m_spriteBatch->setLayer(Runa::SpriteBatch::LAYER_WORLD);
     Runa::ECS::Systems::renderSprites(m_registry->getRegistry(), *m_spriteBatch,
-                                      *m_camera, m_whitePixelTexture.get());
+                                      m_whitePixelTexture.get(), alpha);
 
+    m_spriteBatch->end();
 
+    // Text on top, in screen pixels
+    m_spriteBatch->begin();
     Runa::ECS::RPGSystems::renderDamageNumbers(
         m_registry->getRegistry(), *m_spriteBatch, *m_font, *m_camera);
 
@@ -460,11 +420,6 @@ protected:
         for (int x = startX; x <= endX; ++x) {
           int tileIndex = m_tileMap->getTile(x, y);
 
-          int screenX, screenY;
-
-          m_camera->worldToScreen(x * 32.0f + 16.0f, y * 32.0f + 16.0f, screenX, screenY);
-
-
           float r = 0.2f, g = 0.6f, b = 0.2f;
           if (tileIndex == 1) {
 
@@ -478,10 +433,8 @@ protected:
           }
 
 
-          int drawX = screenX - 16;
-          int drawY = screenY - 16;
-          // Use first overload with srcWidth/srcHeight, scale will be applied by s_pixelScale
-          m_spriteBatch->draw(*m_whitePixelTexture, drawX, drawY, 0, 0, 1, 1, r, g, b, 1.0f, 32.0f / 3.0f, 32.0f / 3.0f);
+          // One 32x32 world-unit quad per tile; the batch's camera zooms it
+          m_spriteBatch->draw(*m_whitePixelTexture, x * 32.0f, y * 32.0f, 0, 0, 1, 1, r, g, b, 1.0f, 32.0f, 32.0f);
         }
       }
     }
@@ -502,15 +455,18 @@ protected:
     }
 
     int y = 150;
-    if (inv.items.empty()) {
+    if (inv.empty()) {
       auto empty = m_font->renderText("(Empty)", {150, 150, 150, 255});
       if (empty) {
         m_spriteBatch->draw(*empty, 450, y);
       }
     } else {
-      for (const auto &item : inv.items) {
+      for (const auto &stack : inv) {
+        const auto *def = Runa::ECS::ItemDatabase::get(stack.id);
+        if (!def)
+          continue;
         std::string itemText =
-            item.name + " x" + std::to_string(item.stackSize);
+            def->name + " x" + std::to_string(stack.count);
         auto texture = m_font->renderText(itemText, {200, 200, 255, 255});
         if (texture) {
           m_spriteBatch->draw(*texture, 420, y);
@@ -532,6 +488,11 @@ private:
   std::unique_ptr<Runa::Texture> m_whitePixelTexture;
 
   entt::entity m_player;
+  const Runa::ECS::Prefab *m_slimePrefab = nullptr;
+  const Runa::ECS::Prefab *m_potionPrefab = nullptr;
+  const Runa::ECS::Prefab *m_coinPrefab = nullptr;
+  Runa::ECS::ItemId m_potionId = Runa::ECS::InvalidItemId;
+  Runa::ECS::ItemId m_coinId = Runa::ECS::InvalidItemId;
   float m_gameTime = 0.0f;
   bool m_showInventory = false;
   bool m_gameOver = false;
@@ -544,7 +505,7 @@ int main(int argc, char *argv[]) {
   LOG_INFO("Starting Runa RPG...");
 
   try {
-    RunaRPG game;
+    RunaRPG game(Runa::ApplicationOptions::parse(argc, argv));
     game.run();
   } catch (const std::exception &e) {
     LOG_CRITICAL("Fatal error: {}", e.what());
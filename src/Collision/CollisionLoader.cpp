@@ -1,4 +1,5 @@
 #include "CollisionLoader.h"
+#include "../Core/JobSystem.h"
 #include "../Core/Log.h"
 #include <yaml-cpp/yaml.h>
 #include <fstream>
@@ -23,7 +24,9 @@ int CollisionLoader::loadFromYAML(const std::string& filePath, CollisionMap& col
             tileSize = root["meta"]["tile_size"].as<int>();
         }
         
-        int count = 0;
+        std::vector<TileDefinition> definitions;
+        std::vector<MaskRegion> maskRegions;
+        std::vector<size_t> maskOwners;     // Index into definitions for each mask region
         
         for (const auto& tileNode : root["tiles"]) {
             TileDefinition def;
@@ -78,7 +81,9 @@ int CollisionLoader::loadFromYAML(const std::string& filePath, CollisionMap& col
                             (tileNode["tile_size"] ? tileNode["tile_size"].as<int>() : tileSize);
                 
                 if (spriteSheet) {
-                    def.pixelMask = createMaskFromSprite(spriteSheet, atlasX, atlasY, width, height);
+                    // Baked together after parsing, so the image is decoded only once
+                    maskRegions.push_back({atlasX, atlasY, width, height});
+                    maskOwners.push_back(definitions.size());
                 } else {
                     def.pixelMask = std::make_shared<CollisionMask>(CollisionMask::solid(width, height));
                 }
@@ -121,10 +126,21 @@ int CollisionLoader::loadFromYAML(const std::string& filePath, CollisionMap& col
                 def.interaction.type = InteractionType::Toggle;
             }
             
+            definitions.push_back(std::move(def));
+        }
+        
+        if (!maskRegions.empty()) {
+            auto masks = createMasksFromSprite(spriteSheet, maskRegions);
+            for (size_t i = 0; i < masks.size(); ++i) {
+                definitions[maskOwners[i]].pixelMask = std::move(masks[i]);
+            }
+        }
+        
+        for (const auto& def : definitions) {
             collisionMap.addTileDefinition(def);
-            count++;
         }
         
+        int count = static_cast<int>(definitions.size());
         LOG_INFO("CollisionLoader: Loaded {} tile definitions from {}", count, filePath);
         return count;
         
@@ -184,9 +200,41 @@ std::shared_ptr<CollisionMask> CollisionLoader::createMaskFromSprite(
     SpriteSheet* spriteSheet, int atlasX, int atlasY, 
     int width, int height, uint8_t alphaThreshold) {
     
+    MaskRegion region{atlasX, atlasY, width, height};
+    return createMasksFromSprite(spriteSheet, std::span<const MaskRegion>(&region, 1), alphaThreshold)[0];
+}
+
+std::vector<std::shared_ptr<CollisionMask>> CollisionLoader::createMasksFromSprite(
+    SpriteSheet* spriteSheet, std::span<const MaskRegion> regions, uint8_t alphaThreshold) {
+    
+    std::vector<std::shared_ptr<CollisionMask>> masks(regions.size());
+    if (regions.empty()) {
+        return masks;
+    }
+    
+    SDL_Surface* surface = loadRGBASurface(spriteSheet);
+    if (!surface) {
+        for (size_t i = 0; i < regions.size(); ++i) {
+            masks[i] = std::make_shared<CollisionMask>(CollisionMask::solid(regions[i].width, regions[i].height));
+        }
+        return masks;
+    }
+    
+    // Each region reads the shared surface and writes only its own slot
+    JobSystem::parallelFor(regions.size(), 1, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            masks[i] = createMaskFromSurface(surface, regions[i], alphaThreshold);
+        }
+    });
+    
+    SDL_DestroySurface(surface);
+    return masks;
+}
+
+SDL_Surface* CollisionLoader::loadRGBASurface(SpriteSheet* spriteSheet) {
     if (!spriteSheet) {
         LOG_WARN("CollisionLoader: No sprite sheet provided for pixel mask");
-        return std::make_shared<CollisionMask>(CollisionMask::solid(width, height));
+        return nullptr;
     }
     
     // Load the image file directly with SDL_image to extract pixel data
@@ -197,7 +245,7 @@ std::shared_ptr<CollisionMask> CollisionLoader::createMaskFromSprite(
     if (!imageSurface) {
         LOG_WARN("CollisionLoader: Failed to load image '{}' for pixel mask: {}", 
                  imagePath, SDL_GetError());
-        return std::make_shared<CollisionMask>(CollisionMask::solid(width, height));
+        return nullptr;
     }
     
     // Convert to RGBA format (SDL3 surfaces may be in various formats)
@@ -205,40 +253,29 @@ std::shared_ptr<CollisionMask> CollisionLoader::createMaskFromSprite(
     SDL_DestroySurface(imageSurface);
     if (!rgbaSurface) {
         LOG_WARN("CollisionLoader: Failed to convert image to RGBA format: {}", SDL_GetError());
-        return std::make_shared<CollisionMask>(CollisionMask::solid(width, height));
+        return nullptr;
     }
-    imageSurface = rgbaSurface;
+    return rgbaSurface;
+}
+
+std::shared_ptr<CollisionMask> CollisionLoader::createMaskFromSurface(
+    const SDL_Surface* surface, const MaskRegion& region, uint8_t alphaThreshold) {
+    
+    const int atlasX = region.atlasX;
+    const int atlasY = region.atlasY;
+    const int width = region.width;
+    const int height = region.height;
     
     // Validate sprite region bounds
-    if (atlasX + width > imageSurface->w || atlasY + height > imageSurface->h) {
+    if (atlasX < 0 || atlasY < 0 || atlasX + width > surface->w || atlasY + height > surface->h) {
         LOG_WARN("CollisionLoader: Sprite region ({}, {}, {}x{}) exceeds image bounds ({}x{})",
-                 atlasX, atlasY, width, height, imageSurface->w, imageSurface->h);
-        SDL_DestroySurface(imageSurface);
+                 atlasX, atlasY, width, height, surface->w, surface->h);
         return std::make_shared<CollisionMask>(CollisionMask::solid(width, height));
     }
     
-    // Extract the sprite region
-    // Create a new surface for just this sprite
-    SDL_Surface* spriteSurface = SDL_CreateSurface(width, height, SDL_PIXELFORMAT_RGBA32);
-    if (!spriteSurface) {
-        LOG_WARN("CollisionLoader: Failed to create sprite surface");
-        SDL_DestroySurface(imageSurface);
-        return std::make_shared<CollisionMask>(CollisionMask::solid(width, height));
-    }
-    
-    // Copy the sprite region from the image
-    SDL_Rect srcRect = {atlasX, atlasY, width, height};
-    SDL_Rect dstRect = {0, 0, width, height};
-    if (SDL_BlitSurface(imageSurface, &srcRect, spriteSurface, &dstRect) != 0) {
-        LOG_WARN("CollisionLoader: Failed to extract sprite region: {}", SDL_GetError());
-        SDL_DestroySurface(spriteSurface);
-        SDL_DestroySurface(imageSurface);
-        return std::make_shared<CollisionMask>(CollisionMask::solid(width, height));
-    }
-    
-    // Create collision mask from alpha channel
-    const uint8_t* pixels = static_cast<const uint8_t*>(spriteSurface->pixels);
-    int stride = spriteSurface->pitch;  // Bytes per row
+    // Read the region in place rather than blitting it to its own surface
+    int stride = surface->pitch;  // Bytes per row
+    const uint8_t* pixels = static_cast<const uint8_t*>(surface->pixels) + atlasY * stride + atlasX * 4;
     
     auto mask = std::make_shared<CollisionMask>(
         CollisionMask::fromAlphaChannel(pixels, width, height, stride, alphaThreshold));
@@ -248,9 +285,7 @@ std::shared_ptr<CollisionMask> CollisionLoader::createMaskFromSprite(
     int transparentPixels = 0;
     for (int y = 0; y < height; ++y) {
         for (int x = 0; x < width; ++x) {
-            const uint8_t* pixel = pixels + (y * stride) + (x * 4);
-            uint8_t alpha = pixel[3];
-            if (alpha >= alphaThreshold) {
+            if (mask->isPixelSolid(x, y)) {
                 solidPixels++;
             } else {
                 transparentPixels++;
@@ -258,10 +293,6 @@ std::shared_ptr<CollisionMask> CollisionLoader::createMaskFromSprite(
         }
     }
     
-    // Clean up
-    SDL_DestroySurface(spriteSurface);
-    SDL_DestroySurface(imageSurface);
-    
     LOG_INFO("CollisionLoader: Created pixel-perfect mask for sprite at ({}, {}) size {}x{} - {} solid, {} transparent", 
               atlasX, atlasY, width, height, solidPixels, transparentPixels);
     
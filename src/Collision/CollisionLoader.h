@@ -7,6 +7,8 @@
 #include "../Graphics/SpriteSheet.h"
 #include <string>
 #include <memory>
+#include <span>
+#include <vector>
 
 namespace Runa {
 
@@ -59,6 +61,16 @@ namespace Runa {
  *     loot_table: "common_chest"
  *     one_time: true
  */
+/**
+ * Atlas rectangle to bake a pixel mask from
+ */
+struct RUNA_API MaskRegion {
+    int atlasX = 0;
+    int atlasY = 0;
+    int width = 0;
+    int height = 0;
+};
+
 class RUNA_API CollisionLoader {
 public:
     /**
@@ -94,6 +106,21 @@ public:
     static std::shared_ptr<CollisionMask> createMaskFromSprite(
         SpriteSheet* spriteSheet, int atlasX, int atlasY,
         int width, int height, uint8_t alphaThreshold = 128);
+
+    /**
+     * Bake masks for several regions of one sprite sheet. The image is decoded
+     * once and the masks are built in parallel on the JobSystem.
+     * @return One mask per region, in order (solid where a region can't be read)
+     */
+    static std::vector<std::shared_ptr<CollisionMask>> createMasksFromSprite(
+        SpriteSheet* spriteSheet, std::span<const MaskRegion> regions, uint8_t alphaThreshold = 128);
+
+private:
+    // Decode the sheet's image file to RGBA32; nullptr (and a warning) on failure
+    static SDL_Surface* loadRGBASurface(SpriteSheet* spriteSheet);
+
+    static std::shared_ptr<CollisionMask> createMaskFromSurface(
+        const SDL_Surface* surface, const MaskRegion& region, uint8_t alphaThreshold);
 };
 
 } // namespace Runa
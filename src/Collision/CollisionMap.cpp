@@ -315,6 +315,26 @@ TileInteraction* CollisionMap::getInteractionAt(float worldX, float worldY) {
     return nullptr;
 }
 
+void CollisionMap::captureInteractionState(std::vector<uint8_t>& out) const {
+    out.resize(m_tileDefinitions.size());
+    for (size_t i = 0; i < m_tileDefinitions.size(); ++i) {
+        out[i] = m_tileDefinitions[i].interaction.consumed ? 1 : 0;
+    }
+}
+
+bool CollisionMap::restoreInteractionState(const uint8_t* state, size_t size) {
+    if (size != m_tileDefinitions.size()) {
+        LOG_WARN("CollisionMap::restoreInteractionState: Expected {} tile definitions, got {}",
+                 m_tileDefinitions.size(), size);
+        return false;
+    }
+    
+    for (size_t i = 0; i < size; ++i) {
+        m_tileDefinitions[i].interaction.consumed = state[i] != 0;
+    }
+    return true;
+}
+
 std::vector<TileInteraction*> CollisionMap::getInteractionsInRange(float x, float y, float range) {
     std::vector<TileInteraction*> result;
     
@@ -108,6 +108,10 @@ public:
     TileInteraction* getInteractionAt(float worldX, float worldY);
     std::vector<TileInteraction*> getInteractionsInRange(float x, float y, float range);
     
+    // Runtime interaction state (consumed flags), one byte per tile definition, for save states
+    void captureInteractionState(std::vector<uint8_t>& out) const;
+    bool restoreInteractionState(const uint8_t* state, size_t size);
+    
     // Get tiles in a region (for rendering or broad-phase collision)
     std::vector<const PlacedTile*> getTilesInRegion(float x, float y, 
                                                      float width, float height) const;
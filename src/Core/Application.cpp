@@ -2,18 +2,52 @@
 
 #include "Application.h"
 #include "../runapch.h"
+#include "JobSystem.h"
 #include "Log.h"
+#include "Random.h"
 #include "SceneManager.h"
+#include "../Graphics/SpriteBatch.h"
+#include <cstdlib>
 
 namespace Runa {
 
-Application::Application(const std::string &title, int width, int height) {
-
-
+ApplicationOptions ApplicationOptions::parse(int argc, char *argv[]) {
+  ApplicationOptions options;
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    bool hasValue = i + 1 < argc;
+
+    if (arg == "--headless") {
+      options.headless = true;
+    } else if (arg == "--fixed-dt" && hasValue) {
+      options.fixedDeltaTime = std::strtof(argv[++i], nullptr);
+    } else if (arg == "--pipelined") {
+      options.pipelined = true;
+    } else if (arg == "--jobs" && hasValue) {
+      options.jobWorkers = std::atoi(argv[++i]);
+    } else if (arg == "--tick-rate" && hasValue) {
+      options.ticksPerSecond = std::atoi(argv[++i]);
+    } else if (arg == "--max-ticks" && hasValue) {
+      options.maxTicksPerFrame = std::max(1, std::atoi(argv[++i]));
+    } else if (arg == "--frames" && hasValue) {
+      options.maxFrames = std::strtoull(argv[++i], nullptr, 10);
+    } else if (arg == "--record" && hasValue) {
+      options.recordPath = argv[++i];
+    } else if (arg == "--replay" && hasValue) {
+      options.replayPath = argv[++i];
+    }
+  }
+  return options;
+}
 
+Application::Application(const std::string &title, int width, int height,
+                         const ApplicationOptions &options)
+    : m_options(options) {
 
 
-  if (!SDL_Init(SDL_INIT_VIDEO | SDL_INIT_EVENTS)) {
+  // Headless runs need only the event queue (quit requests, Ctrl+C)
+  SDL_InitFlags sdlFlags = m_options.headless ? SDL_INIT_EVENTS : (SDL_INIT_VIDEO | SDL_INIT_EVENTS);
+  if (!SDL_Init(sdlFlags)) {
     throw std::runtime_error(std::string("Failed to initialize SDL: ") +
                              SDL_GetError());
   }
@@ -21,6 +55,9 @@ Application::Application(const std::string &title, int width, int height) {
   LOG_INFO("SDL3 initialized successfully");
 
 
+  // Before anything that loads assets, so loaders can already fan out
+  JobSystem::init(m_options.jobWorkers);
+
 
   if (!TTF_Init()) {
     LOG_WARN("Failed to initialize SDL_ttf: {}", SDL_GetError());
@@ -30,22 +67,36 @@ Application::Application(const std::string &title, int width, int height) {
   }
 
 
-  m_window = std::make_unique<Window>(title, width, height);
+  m_window = std::make_unique<Window>(title, width, height, m_options.headless);
   m_renderer = std::make_unique<Renderer>(*m_window);
 
 
   m_input = std::make_unique<Input>(*m_window);
   m_window->setInput(m_input.get());
+  m_inputRecorder = std::make_unique<InputRecorder>();
   LOG_INFO("Input system initialized");
 
 
+  if (!m_options.replayPath.empty()) {
+    if (!m_inputRecorder->startReplay(m_options.replayPath)) {
+      throw std::runtime_error("Failed to load input recording: " + m_options.replayPath);
+    }
+  } else if (!m_options.recordPath.empty()) {
+    m_inputRecorder->startRecording(m_options.recordPath);
+  }
+
+
   m_sceneManager = std::make_unique<SceneManager>();
   LOG_INFO("SceneManager initialized");
 }
 
 Application::~Application() {
+  stopSimulationThread();
   onShutdown();
 
+  // Drain outstanding jobs while the scenes and renderer they may touch still exist
+  JobSystem::shutdown();
+
   m_renderer.reset();
   m_window.reset();
 
@@ -67,6 +118,14 @@ void Application::run() {
   m_running = true;
 
 
+  // Seed before onInit() so world generation is part of a replay too
+  uint64_t seed = m_inputRecorder->isReplaying()
+                      ? m_inputRecorder->getSeed()
+                      : static_cast<uint64_t>(std::chrono::system_clock::now().time_since_epoch().count());
+  Random::game().setSeed(seed);
+  m_inputRecorder->setSeed(seed);
+
+
   try {
     onInit();
     LOG_INFO("onInit() completed successfully");
@@ -80,6 +139,11 @@ void Application::run() {
 
   LOG_INFO("Starting main loop...");
   mainLoop();
+  stopSimulationThread();
+
+
+  // Finish while the game's InputManager is still alive
+  m_inputRecorder->stop();
 }
 
 void Application::mainLoop() {
@@ -88,18 +152,28 @@ void Application::mainLoop() {
   using namespace std::chrono_literals;
 
   auto lastTime = Clock::now();
+  auto loopStart = lastTime;
   float accumulatedTime = 0.0f;
   int frameCount = 0;
+  uint64_t totalFrames = 0;
+
+  // Start one tick in, so the first frame simulates before anything is drawn
+  m_tickAccumulator = getFixedTimeStep();
+  m_droppedTicks = 0;
 
   while (m_running && !m_window->shouldClose()) {
+    if (m_options.maxFrames > 0 && totalFrames >= m_options.maxFrames) {
+      break;
+    }
 
 
     auto currentTime = Clock::now();
-    float deltaTime = Duration(currentTime - lastTime).count();
+    float frameTime = Duration(currentTime - lastTime).count();
     lastTime = currentTime;
+    float deltaTime = m_options.fixedDeltaTime > 0.0f ? m_options.fixedDeltaTime : frameTime;
 
 
-    accumulatedTime += deltaTime;
+    accumulatedTime += frameTime;
     frameCount++;
     if (accumulatedTime >= 1.0f) {
       m_currentFPS = frameCount;
@@ -111,26 +185,162 @@ void Application::mainLoop() {
     }
 
 
+    // Input edges (pressed/released) accumulate until a tick has seen them
     m_window->processEvents();
 
 
-    m_input->beginFrame();
+    // A replay replaces wall-clock dt and live input with the recorded frame
+    if (m_inputRecorder->isReplaying()) {
+      if (!m_inputRecorder->replayFrame(deltaTime, *m_input)) {
+        break;
+      }
+    } else {
+      m_inputRecorder->recordFrame(deltaTime, *m_input);
+    }
+
 
+    if (m_options.pipelined && m_sceneManager->isPipelineSafe()) {
+      // Frame N+1 simulates on the worker while frame N's snapshots are drawn here
+      m_sceneManager->setDeferTransitions(true);
+      startSimulation(deltaTime);
+      renderFrame();
+      waitForSimulation();
+      m_sceneManager->setDeferTransitions(false);
 
-    if (m_sceneManager->hasScenes()) {
-      m_sceneManager->update(deltaTime);
+      // Scenes entered this frame need a snapshot before their first render
+      if (m_sceneManager->applyPendingTransitions()) {
+        m_sceneManager->extract(m_interpolationAlpha);
+      }
+      m_sceneManager->publishSnapshots();
     } else {
-      onUpdate(deltaTime);
+      simulateFrame(deltaTime);
+      m_sceneManager->publishSnapshots();
+      renderFrame();
     }
+    totalFrames++;
+  }
 
 
-    m_renderer->beginFrame();
-    if (m_sceneManager->hasScenes()) {
-      m_sceneManager->render();
-    } else {
-      onRender();
+  if (m_options.headless && totalFrames > 0) {
+    double seconds = std::chrono::duration<double>(Clock::now() - loopStart).count();
+    LOG_INFO("Headless run: {} frames in {:.2f} s ({:.3f} ms/frame, {:.0f} FPS), {:.1f} draws/frame",
+             totalFrames, seconds, seconds * 1000.0 / static_cast<double>(totalFrames),
+             static_cast<double>(totalFrames) / seconds,
+             static_cast<double>(SpriteBatch::getTotalDrawCount()) / static_cast<double>(totalFrames));
+  }
+  if (m_droppedTicks > 0) {
+    LOG_WARN("Dropped {} simulation ticks that exceeded {} ticks per frame", m_droppedTicks,
+             m_options.maxTicksPerFrame);
+  }
+}
+
+void Application::simulateFrame(float deltaTime) {
+  const float tickStep = getFixedTimeStep();
+  if (tickStep > 0.0f) {
+    m_tickAccumulator += deltaTime;
+    int ticks = 0;
+    while (m_tickAccumulator >= tickStep && ticks < m_options.maxTicksPerFrame) {
+      simulate(tickStep);
+      m_tickAccumulator -= tickStep;
+      ticks++;
+    }
+
+    // Past the catch-up limit, drop the backlog instead of spiralling
+    if (m_tickAccumulator >= tickStep) {
+      uint64_t backlog = static_cast<uint64_t>(m_tickAccumulator / tickStep);
+      m_droppedTicks += backlog;
+      m_tickAccumulator -= static_cast<float>(backlog) * tickStep;
     }
-    m_renderer->endFrame();
+    m_interpolationAlpha = m_tickAccumulator / tickStep;
+  } else {
+    simulate(deltaTime);
+    m_interpolationAlpha = 1.0f;
+  }
+  m_inputRecorder->endFrame();
+
+  m_sceneManager->extract(m_interpolationAlpha);
+}
+
+void Application::simulate(float step) {
+  m_inputRecorder->beginTick();
+  if (m_sceneManager->hasScenes()) {
+    m_sceneManager->update(step);
+  } else {
+    onUpdate(step);
+  }
+  m_inputRecorder->endTick();
+
+
+  // Edges are delivered to exactly one tick
+  m_input->beginFrame();
+}
+
+void Application::renderFrame() {
+  m_renderer->beginFrame();
+  if (m_sceneManager->hasScenes()) {
+    m_sceneManager->render();
+  } else {
+    onRender();
+  }
+  m_renderer->endFrame();
+}
+
+void Application::startSimulation(float deltaTime) {
+  if (!m_simThread.joinable()) {
+    m_simThread = std::thread(&Application::simulationThreadMain, this);
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(m_simMutex);
+    m_simDeltaTime = deltaTime;
+    m_simPending = true;
+  }
+  m_simCondition.notify_all();
+}
+
+void Application::waitForSimulation() {
+  std::unique_lock<std::mutex> lock(m_simMutex);
+  m_simCondition.wait(lock, [this] { return !m_simPending; });
+
+  if (m_simException) {
+    std::rethrow_exception(std::exchange(m_simException, nullptr));
+  }
+}
+
+void Application::stopSimulationThread() {
+  if (!m_simThread.joinable()) {
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(m_simMutex);
+    m_simQuit = true;
+  }
+  m_simCondition.notify_all();
+  m_simThread.join();
+  m_simQuit = false;
+}
+
+void Application::simulationThreadMain() {
+  std::unique_lock<std::mutex> lock(m_simMutex);
+  while (true) {
+    m_simCondition.wait(lock, [this] { return m_simPending || m_simQuit; });
+    if (m_simQuit && !m_simPending) {
+      return;
+    }
+
+    float deltaTime = m_simDeltaTime;
+    lock.unlock();
+    try {
+      simulateFrame(deltaTime);
+    } catch (...) {
+      // Rethrown on the main thread by waitForSimulation()
+      m_simException = std::current_exception();
+    }
+    lock.lock();
+
+    m_simPending = false;
+    m_simCondition.notify_all();
   }
 }
 
@@ -7,16 +7,57 @@
 #include "../RunaAPI.h"
 #include "Graphics/Renderer.h"
 #include "Input.h"
+#include "InputRecorder.h"
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
 
 namespace Runa {
 
 
 class SceneManager;
 
+
+struct RUNA_API ApplicationOptions {
+  // No window, GPU or presentation: a null Renderer and SpriteBatches that only count draws
+  bool headless = false;
+
+  // Simulation rate; scenes are updated in steps of 1 / ticksPerSecond. 0: one variable step per frame
+  int ticksPerSecond = 60;
+
+  // Catch-up limit after a long frame; time beyond it is dropped
+  int maxTicksPerFrame = 5;
+
+  // Simulate the next frame on a worker thread while the current one is drawn. Only
+  // applies while every rendered scene is pipeline-safe (see Scene::onExtract)
+  bool pipelined = false;
+
+  // JobSystem worker threads; < 0 uses one per core minus the main thread, 0 runs jobs inline
+  int jobWorkers = -1;
+
+  // > 0: treat every frame as lasting this long instead of measuring wall-clock time
+  float fixedDeltaTime = 0.0f;
+
+  // > 0: stop after this many frames
+  uint64_t maxFrames = 0;
+
+  // Input session to record to or replay from (see InputRecorder)
+  std::string recordPath;
+  std::string replayPath;
+
+  // --headless, --pipelined, --jobs <count>, --tick-rate <hz>, --max-ticks <count>,
+  // --fixed-dt <seconds>, --frames <count>, --record <file>, --replay <file>
+  static ApplicationOptions parse(int argc, char *argv[]);
+};
+
 class RUNA_API Application {
 public:
-  Application(const std::string &title, int width, int height);
+  Application(const std::string &title, int width, int height,
+              const ApplicationOptions &options = {});
   virtual ~Application();
 
   void run();
@@ -25,10 +66,21 @@ public:
   Window &getWindow() { return *m_window; }
   Renderer &getRenderer() { return *m_renderer; }
   Input &getInput() { return *m_input; }
+  InputRecorder &getInputRecorder() { return *m_inputRecorder; }
   SceneManager &getSceneManager();
 
 
   int getFPS() const { return m_currentFPS; }
+  bool isHeadless() const { return m_options.headless; }
+
+  // Seconds per simulation tick, or 0 when updating once per frame
+  float getFixedTimeStep() const {
+    return m_options.ticksPerSecond > 0 ? 1.0f / static_cast<float>(m_options.ticksPerSecond) : 0.0f;
+  }
+
+  // Fraction of a tick elapsed since the last one; interpolate rendering with it
+  float getInterpolationAlpha() const { return m_interpolationAlpha; }
+  const ApplicationOptions &getOptions() const { return m_options; }
 
 protected:
   virtual void onInit() {}
@@ -37,14 +89,36 @@ protected:
   virtual void onShutdown() {}
 
 private:
+  ApplicationOptions m_options;
   std::unique_ptr<Window> m_window;
   std::unique_ptr<Renderer> m_renderer;
   std::unique_ptr<Input> m_input;
+  std::unique_ptr<InputRecorder> m_inputRecorder;
   std::unique_ptr<SceneManager> m_sceneManager;
   bool m_running = false;
   int m_currentFPS = 0;
+  float m_interpolationAlpha = 1.0f;
+  float m_tickAccumulator = 0.0f;
+  uint64_t m_droppedTicks = 0;
+
+  // Pipelined mode: one persistent simulation worker, handed a frame at a time
+  std::thread m_simThread;
+  std::mutex m_simMutex;
+  std::condition_variable m_simCondition;
+  bool m_simPending = false;
+  bool m_simQuit = false;
+  float m_simDeltaTime = 0.0f;
+  std::exception_ptr m_simException;
 
   void mainLoop();
+  void simulateFrame(float deltaTime);
+  void simulate(float step);
+  void renderFrame();
+
+  void startSimulation(float deltaTime);
+  void waitForSimulation();
+  void stopSimulationThread();
+  void simulationThreadMain();
 };
 
 }
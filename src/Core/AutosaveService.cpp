@@ -0,0 +1,457 @@
+// File: src/Core/AutosaveService.cpp
+
+/**
+ * AutosaveService.cpp
+ * Save file encoding, RLE compression and the background writer thread.
+ *
+ * File layout:
+ *   SaveHeader                      magic, version, raw/compressed sizes, checksum of the raw payload
+ *   RLE-compressed payload:
+ *     uint32 stringCount, then per string: uint32 length, bytes   (StringPool ids 1..stringCount)
+ *     uint32 interactionStateSize, bytes                        (0xFFFFFFFF = none)
+ *     uint64 snapshotSize, RegistrySnapshot bytes
+ */
+
+#include "../runapch.h"
+#include "AutosaveService.h"
+#include "Log.h"
+#include "StringPool.h"
+#include "../Collision/CollisionMap.h"
+#include "../ECS/Components.h"
+#include "../ECS/QuestTracker.h"
+#include "../ECS/RPGComponents.h"
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace Runa {
+
+    namespace {
+
+        constexpr uint32_t SaveMagic = 0x56415352;  // "RSAV"
+        constexpr uint32_t SaveVersion = 1;
+        constexpr uint32_t NoInteractionState = 0xFFFFFFFFu;
+
+        struct SaveHeader {
+            uint32_t magic = SaveMagic;
+            uint32_t version = SaveVersion;
+            uint64_t rawSize = 0;
+            uint64_t compressedSize = 0;
+            uint64_t checksum = 0;
+        };
+
+        uint64_t fnv1a(const uint8_t* data, size_t size) {
+            uint64_t hash = 14695981039346656037ull;
+            for (size_t i = 0; i < size; ++i) {
+                hash ^= data[i];
+                hash *= 1099511628211ull;
+            }
+            return hash;
+        }
+
+        template<typename T>
+        void append(std::vector<uint8_t>& out, const T& value) {
+            const auto* bytes = reinterpret_cast<const uint8_t*>(&value);
+            out.insert(out.end(), bytes, bytes + sizeof(T));
+        }
+
+        void appendBytes(std::vector<uint8_t>& out, const void* data, size_t size) {
+            const auto* bytes = static_cast<const uint8_t*>(data);
+            out.insert(out.end(), bytes, bytes + size);
+        }
+
+        /**
+         * PackBits-style RLE. Control byte c < 128: c + 1 literal bytes follow.
+         * c >= 128: the next byte repeats c - 125 times (3..130).
+         * Snapshots are mostly small integers and zeroed floats, which this catches cheaply.
+         */
+        void rleEncode(const uint8_t* in, size_t size, std::vector<uint8_t>& out) {
+            out.clear();
+            out.reserve(size / 2 + 16);
+
+            size_t i = 0;
+            while (i < size) {
+                size_t run = 1;
+                while (i + run < size && run < 130 && in[i + run] == in[i]) {
+                    run++;
+                }
+
+                if (run >= 3) {
+                    out.push_back(static_cast<uint8_t>(run + 125));
+                    out.push_back(in[i]);
+                    i += run;
+                    continue;
+                }
+
+                // Literal block up to the next run of 3 or 128 bytes
+                size_t start = i;
+                size_t length = 0;
+                while (i < size && length < 128) {
+                    if (i + 2 < size && in[i] == in[i + 1] && in[i] == in[i + 2]) {
+                        break;
+                    }
+                    i++;
+                    length++;
+                }
+                out.push_back(static_cast<uint8_t>(length - 1));
+                out.insert(out.end(), in + start, in + start + length);
+            }
+        }
+
+        bool rleDecode(const uint8_t* in, size_t size, size_t rawSize, std::vector<uint8_t>& out) {
+            out.clear();
+            out.reserve(rawSize);
+
+            size_t i = 0;
+            while (i < size) {
+                uint8_t control = in[i++];
+                if (control < 128) {
+                    size_t length = static_cast<size_t>(control) + 1;
+                    if (i + length > size || out.size() + length > rawSize) return false;
+                    out.insert(out.end(), in + i, in + i + length);
+                    i += length;
+                } else {
+                    size_t run = static_cast<size_t>(control) - 125;
+                    if (i >= size || out.size() + run > rawSize) return false;
+                    out.insert(out.end(), run, in[i++]);
+                }
+            }
+            return out.size() == rawSize;
+        }
+
+        class PayloadReader {
+        public:
+            PayloadReader(const uint8_t* data, size_t size) : m_data(data), m_size(size) {}
+
+            template<typename T>
+            bool read(T& value) {
+                if (m_offset + sizeof(T) > m_size) return false;
+                std::memcpy(&value, m_data + m_offset, sizeof(T));
+                m_offset += sizeof(T);
+                return true;
+            }
+
+            const uint8_t* take(size_t bytes) {
+                if (m_offset + bytes > m_size) return nullptr;
+                const uint8_t* ptr = m_data + m_offset;
+                m_offset += bytes;
+                return ptr;
+            }
+
+        private:
+            const uint8_t* m_data;
+            size_t m_size;
+            size_t m_offset = 0;
+        };
+
+        // Saved StringIds belong to the writing process; translate them to this one's
+        void remapStrings(entt::registry& registry, const std::vector<StringId>& remap) {
+            auto translate = [&remap](StringId id) {
+                return id < remap.size() ? remap[id] : NullStringId;
+            };
+
+            for (auto [entity, sprite] : registry.view<ECS::Sprite>().each()) {
+                sprite.spriteName = translate(sprite.spriteName);
+                sprite.spriteSheet = nullptr;
+            }
+            for (auto [entity, interactable] : registry.view<ECS::Interactable>().each()) {
+                interactable.data = translate(interactable.data);
+                interactable.targetScene = translate(interactable.targetScene);
+            }
+            for (auto [entity, kind] : registry.view<ECS::EnemyKind>().each()) {
+                kind.id = translate(kind.id);
+            }
+            for (auto [entity, giver] : registry.view<ECS::QuestGiver>().each()) {
+                giver.npcName = translate(giver.npcName);
+                giver.dialogueText = translate(giver.dialogueText);
+                giver.quest.id = translate(giver.quest.id);
+                giver.quest.title = translate(giver.quest.title);
+                giver.quest.description = translate(giver.quest.description);
+                for (auto& objective : giver.quest.getObjectives()) {
+                    objective.target = translate(objective.target);
+                }
+            }
+        }
+    }
+
+    AutosaveService::AutosaveService() {
+        m_worker = std::thread([this]() { workerLoop(); });
+    }
+
+    AutosaveService::~AutosaveService() {
+        {
+            std::lock_guard lock(m_mutex);
+            m_stopping = true;
+        }
+        m_wake.notify_all();
+        if (m_worker.joinable()) {
+            m_worker.join();
+        }
+    }
+
+    bool AutosaveService::requestSave(const entt::registry& registry, const CollisionMap* collisionMap,
+                                      const std::string& filePath) {
+        Job* job = nullptr;
+        {
+            std::lock_guard lock(m_mutex);
+            for (auto& candidate : m_jobs) {
+                if (candidate.state == JobState::Free) {
+                    job = &candidate;
+                    break;
+                }
+            }
+        }
+
+        if (!job) {
+            LOG_DEBUG("Autosave skipped: previous saves are still being written");
+            return false;
+        }
+
+        // A Free job is owned by this thread until it is queued
+        auto start = std::chrono::steady_clock::now();
+
+        job->snapshot.capture(registry);
+        job->hasInteractionState = collisionMap != nullptr;
+        if (collisionMap) {
+            collisionMap->captureInteractionState(job->interactionState);
+        }
+        job->stringCount = StringPool::size();
+        job->filePath = filePath;
+
+        auto captureUs = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start).count();
+        LOG_DEBUG("Autosave captured {} entities ({} bytes) in {} us",
+                  job->snapshot.getEntityCount(), job->snapshot.bytes().size(), captureUs);
+
+        {
+            std::lock_guard lock(m_mutex);
+            job->sequence = m_nextSequence++;
+            job->state = JobState::Queued;
+        }
+        m_wake.notify_one();
+        return true;
+    }
+
+    void AutosaveService::update(float dt, const entt::registry& registry, const CollisionMap* collisionMap,
+                                 const std::string& filePath) {
+        if (m_interval <= 0.0f) {
+            return;
+        }
+
+        m_timer += dt;
+        if (m_timer >= m_interval) {
+            m_timer = 0.0f;
+            requestSave(registry, collisionMap, filePath);
+        }
+    }
+
+    void AutosaveService::waitIdle() {
+        std::unique_lock lock(m_mutex);
+        m_idle.wait(lock, [this]() {
+            for (const auto& job : m_jobs) {
+                if (job.state != JobState::Free) return false;
+            }
+            return true;
+        });
+    }
+
+    bool AutosaveService::isBusy() const {
+        std::lock_guard lock(m_mutex);
+        for (const auto& job : m_jobs) {
+            if (job.state != JobState::Free) return true;
+        }
+        return false;
+    }
+
+    void AutosaveService::workerLoop() {
+        while (true) {
+            Job* job = nullptr;
+            {
+                std::unique_lock lock(m_mutex);
+                m_wake.wait(lock, [this]() {
+                    if (m_stopping) return true;
+                    for (const auto& candidate : m_jobs) {
+                        if (candidate.state == JobState::Queued) return true;
+                    }
+                    return false;
+                });
+
+                // Oldest first, so a newer save is never overwritten by an older one
+                for (auto& candidate : m_jobs) {
+                    if (candidate.state == JobState::Queued && (!job || candidate.sequence < job->sequence)) {
+                        job = &candidate;
+                    }
+                }
+
+                if (!job) {
+                    return;  // Stopping with nothing left to write
+                }
+                job->state = JobState::Writing;
+            }
+
+            writeJob(*job);
+
+            {
+                std::lock_guard lock(m_mutex);
+                job->state = JobState::Free;
+            }
+            m_idle.notify_all();
+        }
+    }
+
+    bool AutosaveService::writeJob(const Job& job) {
+        auto start = std::chrono::steady_clock::now();
+
+        try {
+            // Encode
+            std::vector<uint8_t> payload;
+            auto snapshotBytes = job.snapshot.bytes();
+            payload.reserve(snapshotBytes.size() + job.interactionState.size() + 4096);
+
+            append(payload, static_cast<uint32_t>(job.stringCount));
+            for (size_t id = 1; id <= job.stringCount; ++id) {
+                const std::string& str = StringPool::lookup(static_cast<StringId>(id));
+                append(payload, static_cast<uint32_t>(str.size()));
+                appendBytes(payload, str.data(), str.size());
+            }
+
+            if (job.hasInteractionState) {
+                append(payload, static_cast<uint32_t>(job.interactionState.size()));
+                appendBytes(payload, job.interactionState.data(), job.interactionState.size());
+            } else {
+                append(payload, NoInteractionState);
+            }
+
+            append(payload, static_cast<uint64_t>(snapshotBytes.size()));
+            appendBytes(payload, snapshotBytes.data(), snapshotBytes.size());
+
+            // Compress
+            std::vector<uint8_t> compressed;
+            rleEncode(payload.data(), payload.size(), compressed);
+
+            SaveHeader header;
+            header.rawSize = payload.size();
+            header.compressedSize = compressed.size();
+            header.checksum = fnv1a(payload.data(), payload.size());
+
+            // Write to a temp file, then rename over the target
+            std::filesystem::path path(job.filePath);
+            if (path.has_parent_path()) {
+                std::filesystem::create_directories(path.parent_path());
+            }
+            std::filesystem::path tempPath = path;
+            tempPath += ".tmp";
+
+            {
+                std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+                if (!file.is_open()) {
+                    LOG_ERROR("Autosave: Failed to open file for writing: {}", tempPath.string());
+                    return false;
+                }
+                file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+                file.write(reinterpret_cast<const char*>(compressed.data()), static_cast<std::streamsize>(compressed.size()));
+                file.flush();
+                if (!file) {
+                    LOG_ERROR("Autosave: Write failed for: {}", tempPath.string());
+                    return false;
+                }
+            }
+
+            std::filesystem::rename(tempPath, path);
+
+            auto elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - start).count();
+            LOG_INFO("Autosave written to {} ({} -> {} bytes, {} ms)",
+                     job.filePath, payload.size(), compressed.size() + sizeof(header), elapsedMs);
+            return true;
+
+        } catch (const std::exception& e) {
+            LOG_ERROR("Exception while writing autosave {}: {}", job.filePath, e.what());
+            return false;
+        }
+    }
+
+    bool AutosaveService::load(const std::string& filePath, entt::registry& registry, CollisionMap* collisionMap) {
+        try {
+            std::ifstream file(filePath, std::ios::binary);
+            if (!file.is_open()) {
+                LOG_ERROR("Failed to open save file for reading: {}", filePath);
+                return false;
+            }
+
+            SaveHeader header;
+            file.read(reinterpret_cast<char*>(&header), sizeof(header));
+            if (!file || header.magic != SaveMagic || header.version != SaveVersion) {
+                LOG_ERROR("Invalid save file header: {}", filePath);
+                return false;
+            }
+
+            std::vector<uint8_t> compressed(header.compressedSize);
+            file.read(reinterpret_cast<char*>(compressed.data()), static_cast<std::streamsize>(compressed.size()));
+            if (!file) {
+                LOG_ERROR("Save file is truncated: {}", filePath);
+                return false;
+            }
+
+            std::vector<uint8_t> payload;
+            if (!rleDecode(compressed.data(), compressed.size(), header.rawSize, payload) ||
+                fnv1a(payload.data(), payload.size()) != header.checksum) {
+                LOG_ERROR("Save file is corrupt: {}", filePath);
+                return false;
+            }
+
+            PayloadReader reader(payload.data(), payload.size());
+
+            // String table -> remap from the writer's ids to ours
+            uint32_t stringCount = 0;
+            if (!reader.read(stringCount)) return false;
+            std::vector<StringId> remap(static_cast<size_t>(stringCount) + 1, NullStringId);
+            for (uint32_t id = 1; id <= stringCount; ++id) {
+                uint32_t length = 0;
+                if (!reader.read(length)) return false;
+                const uint8_t* chars = reader.take(length);
+                if (!chars) return false;
+                remap[id] = StringPool::intern(std::string_view(reinterpret_cast<const char*>(chars), length));
+            }
+
+            uint32_t interactionSize = 0;
+            if (!reader.read(interactionSize)) return false;
+            const uint8_t* interactionState = nullptr;
+            if (interactionSize != NoInteractionState) {
+                interactionState = reader.take(interactionSize);
+                if (!interactionState) return false;
+            }
+
+            uint64_t snapshotSize = 0;
+            if (!reader.read(snapshotSize)) return false;
+            const uint8_t* snapshotData = reader.take(static_cast<size_t>(snapshotSize));
+            if (!snapshotData) return false;
+
+            ECS::RegistrySnapshot snapshot;
+            if (!snapshot.assign({reinterpret_cast<const std::byte*>(snapshotData), static_cast<size_t>(snapshotSize)}) ||
+                !snapshot.restore(registry)) {
+                LOG_ERROR("Save file snapshot could not be restored: {}", filePath);
+                return false;
+            }
+            remapStrings(registry, remap);
+
+            // restore() subscribed the objectives under the saved target ids
+            if (auto* tracker = registry.ctx().find<ECS::QuestTracker>()) {
+                tracker->rebuild(registry);
+            }
+
+            if (collisionMap && interactionState) {
+                collisionMap->restoreInteractionState(interactionState, interactionSize);
+            }
+
+            LOG_INFO("Loaded save {} ({} entities)", filePath, snapshot.getEntityCount());
+            return true;
+
+        } catch (const std::exception& e) {
+            LOG_ERROR("Exception while loading save {}: {}", filePath, e.what());
+            return false;
+        }
+    }
+
+}
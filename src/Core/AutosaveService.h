@@ -0,0 +1,111 @@
+// File: src/Core/AutosaveService.h
+
+/**
+ * AutosaveService.h
+ * Background autosave. The main thread only captures a binary registry
+ * snapshot and the CollisionMap interaction flags into a free buffer;
+ * encoding, compression and the atomic file write run on a worker thread.
+ */
+
+#ifndef RUNA_CORE_AUTOSAVESERVICE_H
+#define RUNA_CORE_AUTOSAVESERVICE_H
+
+#include "../RunaAPI.h"
+#include "../ECS/RegistrySnapshot.h"
+#include <entt/entt.hpp>
+#include <array>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Runa {
+
+    class CollisionMap;
+
+    /**
+     * AutosaveService - Double-buffered save pipeline.
+     *
+     * requestSave() never waits for disk: it captures into whichever of the two
+     * buffers is free and returns. If both buffers are still queued or being
+     * written, the request is skipped instead of stalling the frame.
+     *
+     * Files are written to "<path>.tmp" and renamed over the target, so a crash
+     * mid-write leaves the previous save intact.
+     */
+    class RUNA_API AutosaveService {
+    public:
+        AutosaveService();
+        ~AutosaveService();
+
+        AutosaveService(const AutosaveService&) = delete;
+        AutosaveService& operator=(const AutosaveService&) = delete;
+
+        /**
+         * Capture the registry (and optionally the collision map's interaction state)
+         * and queue it to be written to filePath.
+         * @return false if no buffer was free and the save was skipped
+         */
+        bool requestSave(const entt::registry& registry, const CollisionMap* collisionMap,
+                         const std::string& filePath);
+
+        /**
+         * Periodic autosave: calls requestSave() every interval seconds.
+         * An interval <= 0 disables it.
+         */
+        void update(float dt, const entt::registry& registry, const CollisionMap* collisionMap,
+                    const std::string& filePath);
+
+        void setInterval(float seconds) { m_interval = seconds; }
+        float getInterval() const { return m_interval; }
+
+        // Block until every queued save has been written
+        void waitIdle();
+        bool isBusy() const;
+
+        /**
+         * Load a save written by this service (synchronously).
+         * Interned strings are remapped to this process's StringPool ids and
+         * Sprite::spriteSheet pointers are reset to nullptr for the scene to resolve.
+         * @return true if successful, false otherwise
+         */
+        static bool load(const std::string& filePath, entt::registry& registry, CollisionMap* collisionMap);
+
+    private:
+        enum class JobState : uint8_t {
+            Free,
+            Queued,
+            Writing
+        };
+
+        struct Job {
+            JobState state = JobState::Free;
+            uint64_t sequence = 0;
+            std::string filePath;
+            ECS::RegistrySnapshot snapshot;
+            std::vector<uint8_t> interactionState;
+            bool hasInteractionState = false;
+            size_t stringCount = 0;     // StringPool ids [1, stringCount] that existed at capture
+        };
+
+        void workerLoop();
+        static bool writeJob(const Job& job);
+
+        std::array<Job, 2> m_jobs;
+        uint64_t m_nextSequence = 1;
+
+        std::thread m_worker;
+        mutable std::mutex m_mutex;
+        std::condition_variable m_wake;
+        std::condition_variable m_idle;
+        bool m_stopping = false;
+
+        float m_interval = 0.0f;
+        float m_timer = 0.0f;
+    };
+
+}
+
+#endif // RUNA_CORE_AUTOSAVESERVICE_H
@@ -40,6 +40,8 @@ public:
     float getMouseWheel() const;
 
 private:
+    friend class InputRecorder;  // Captures and restores the raw state for replays
+
     Window& m_window;
 
 
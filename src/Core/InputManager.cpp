@@ -53,6 +53,9 @@ namespace Runa {
 	void InputManager::beginFrame() {
 
 		m_actionCache.clear();
+		if (m_replayActions) {
+			m_actionCache = *m_replayActions;
+		}
 
 
 		m_gamepadManager->beginFrame();
@@ -60,6 +63,16 @@ namespace Runa {
 
 
 
+	void InputManager::setReplayActions(const std::unordered_map<std::string, ActionValue>* actions) {
+		m_replayActions = actions;
+		m_actionCache.clear();
+		if (m_replayActions) {
+			m_actionCache = *m_replayActions;
+		}
+	}
+
+
+
 	InputContext* InputManager::createContext(const std::string& name) {
 		auto it = m_contexts.find(name);
 		if (it != m_contexts.end()) {
@@ -125,6 +138,12 @@ namespace Runa {
 		ActionValue result;
 
 
+		// Replays only know the actions the recorded session queried
+		if (m_replayActions) {
+			return result;
+		}
+
+
 		for (auto it = m_activeContexts.rbegin(); it != m_activeContexts.rend(); ++it) {
 			auto contextIt = m_contexts.find(*it);
 			if (contextIt == m_contexts.end()) continue;
@@ -83,6 +83,13 @@ namespace Runa {
 		float getActionAxisY(const std::string& actionName) const;
 
 
+		// Actions evaluated so far this frame (recorded by InputRecorder)
+		const std::unordered_map<std::string, ActionValue>& getFrameActions() const { return m_actionCache; }
+
+		// Serve actions from a replay instead of evaluating bindings; nullptr resumes live input
+		void setReplayActions(const std::unordered_map<std::string, ActionValue>* actions);
+
+
 
 
 		void bindKey(const std::string& contextName, const std::string& actionName, SDL_Keycode key);
@@ -114,6 +121,7 @@ namespace Runa {
 
 
 		mutable std::unordered_map<std::string, ActionValue> m_actionCache;
+		const std::unordered_map<std::string, ActionValue>* m_replayActions = nullptr;
 
 
 		ActionValue evaluateAction(const InputBinding& binding) const;
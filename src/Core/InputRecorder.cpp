@@ -0,0 +1,477 @@
+// File: src/Core/InputRecorder.cpp
+
+/**
+ * InputRecorder.cpp
+ * Log encoding, decoding and replay statistics.
+ *
+ * File layout (little-endian):
+ *   "RREC" | u32 version | u64 seed | u32 frameCount | u32 actionNameCount
+ *   actionNameCount x (u16 length, bytes)
+ *   frameCount x frame
+ *
+ * A frame starts with a u8 change mask and the f32 dt. Key and button sets
+ * follow only when they differ from the previous frame (down) or are not
+ * empty (pressed/released); the mouse position only when it moved and the
+ * wheel only when it is non-zero. The frame ends with a u16 tick count and,
+ * per fixed tick, a u16 action count and per action: u16 name index, u8
+ * type/button bits, and three f32 axes when any axis is non-zero.
+ */
+
+#include "../runapch.h"
+#include "InputRecorder.h"
+#include "Input.h"
+#include "InputManager.h"
+#include "Log.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+namespace Runa {
+
+    namespace {
+
+        constexpr char RecordingMagic[4] = {'R', 'R', 'E', 'C'};
+        constexpr uint32_t RecordingVersion = 2;
+
+        enum FrameBits : uint8_t {
+            KeysDownChanged = 1 << 0,
+            HasKeysPressed = 1 << 1,
+            HasKeysReleased = 1 << 2,
+            ButtonsDownChanged = 1 << 3,
+            HasButtonsPressed = 1 << 4,
+            HasButtonsReleased = 1 << 5,
+            MouseMoved = 1 << 6,
+            HasMouseWheel = 1 << 7
+        };
+
+        enum ActionBits : uint8_t {
+            TypeMask = 0x03,
+            ButtonDown = 1 << 2,
+            ButtonPressed = 1 << 3,
+            ButtonReleased = 1 << 4,
+            HasAxes = 1 << 5
+        };
+
+        template<typename T>
+        void put(std::vector<uint8_t>& out, const T& value) {
+            const auto* bytes = reinterpret_cast<const uint8_t*>(&value);
+            out.insert(out.end(), bytes, bytes + sizeof(T));
+        }
+
+        template<typename T>
+        bool get(const std::vector<uint8_t>& in, size_t& cursor, T& value) {
+            if (cursor + sizeof(T) > in.size()) {
+                return false;
+            }
+            std::memcpy(&value, in.data() + cursor, sizeof(T));
+            cursor += sizeof(T);
+            return true;
+        }
+
+        template<typename T>
+        void putList(std::vector<uint8_t>& out, const std::vector<T>& values) {
+            put(out, static_cast<uint16_t>(values.size()));
+            for (const T& value : values) {
+                put(out, value);
+            }
+        }
+
+        template<typename T>
+        bool getList(const std::vector<uint8_t>& in, size_t& cursor, std::vector<T>& values) {
+            uint16_t count = 0;
+            if (!get(in, cursor, count)) {
+                return false;
+            }
+            values.resize(count);
+            for (T& value : values) {
+                if (!get(in, cursor, value)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // Sorted so identical sets encode identically regardless of hash order
+        template<typename T, typename Set>
+        void sortedCopy(const Set& set, std::vector<T>& out) {
+            out.clear();
+            for (const auto& value : set) {
+                out.push_back(static_cast<T>(value));
+            }
+            std::sort(out.begin(), out.end());
+        }
+
+        template<typename Set, typename T>
+        void assignSet(Set& set, const std::vector<T>& values) {
+            set.clear();
+            for (const T& value : values) {
+                set.insert(static_cast<typename Set::value_type>(value));
+            }
+        }
+
+    }
+
+    InputRecorder::~InputRecorder() {
+        stop();
+    }
+
+    bool InputRecorder::startRecording(const std::string& filePath) {
+        stop();
+
+        m_mode = Mode::Recording;
+        m_filePath = filePath;
+        m_frames.clear();
+        m_actionNames.clear();
+        m_actionIndices.clear();
+        m_previous = FrameState{};
+        m_frameIndex = 0;
+        m_frameCount = 0;
+
+        LOG_INFO("Recording input to: {}", filePath);
+        return true;
+    }
+
+    bool InputRecorder::startReplay(const std::string& filePath) {
+        stop();
+
+        std::ifstream file(filePath, std::ios::binary);
+        if (!file.is_open()) {
+            LOG_ERROR("Failed to open input recording: {}", filePath);
+            return false;
+        }
+        m_data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+
+        size_t cursor = 0;
+        char magic[4] = {};
+        uint32_t version = 0;
+        uint32_t nameCount = 0;
+        bool valid = get(m_data, cursor, magic) && std::memcmp(magic, RecordingMagic, sizeof(magic)) == 0 &&
+                     get(m_data, cursor, version) && version == RecordingVersion &&
+                     get(m_data, cursor, m_seed) && get(m_data, cursor, m_frameCount) &&
+                     get(m_data, cursor, nameCount);
+
+        m_actionNames.clear();
+        for (uint32_t i = 0; valid && i < nameCount; ++i) {
+            uint16_t length = 0;
+            valid = get(m_data, cursor, length) && cursor + length <= m_data.size();
+            if (valid) {
+                m_actionNames.emplace_back(reinterpret_cast<const char*>(m_data.data() + cursor), length);
+                cursor += length;
+            }
+        }
+
+        if (!valid) {
+            LOG_ERROR("Invalid or unsupported input recording: {}", filePath);
+            m_data.clear();
+            return false;
+        }
+
+        m_mode = Mode::Replaying;
+        m_filePath = filePath;
+        m_cursor = cursor;
+        m_current = FrameState{};
+        m_tickActions.clear();
+        m_tickIndex = 0;
+        m_replayActions.clear();
+        m_frameIndex = 0;
+        m_frameTimesMs.clear();
+        m_frameTimesMs.reserve(m_frameCount);
+        m_lastFrameTime = std::chrono::steady_clock::now();
+
+        if (m_inputManager) {
+            m_inputManager->setReplayActions(&m_replayActions);
+        }
+
+        LOG_INFO("Replaying {} frames from: {} (seed {})", m_frameCount, filePath, m_seed);
+        return true;
+    }
+
+    void InputRecorder::stop() {
+        if (m_mode == Mode::Recording) {
+            std::vector<uint8_t> header;
+            put(header, RecordingMagic);
+            put(header, RecordingVersion);
+            put(header, m_seed);
+            put(header, m_frameCount);
+            put(header, static_cast<uint32_t>(m_actionNames.size()));
+            for (const auto& name : m_actionNames) {
+                put(header, static_cast<uint16_t>(name.size()));
+                header.insert(header.end(), name.begin(), name.end());
+            }
+
+            std::ofstream file(m_filePath, std::ios::binary | std::ios::trunc);
+            if (file.is_open()) {
+                file.write(reinterpret_cast<const char*>(header.data()), static_cast<std::streamsize>(header.size()));
+                file.write(reinterpret_cast<const char*>(m_frames.data()), static_cast<std::streamsize>(m_frames.size()));
+            }
+            if (file.is_open() && file.good()) {
+                LOG_INFO("Saved input recording: {} ({} frames, {} bytes)", m_filePath, m_frameCount,
+                         header.size() + m_frames.size());
+            } else {
+                LOG_ERROR("Failed to write input recording: {}", m_filePath);
+            }
+            m_frames.clear();
+        } else if (m_mode == Mode::Replaying) {
+            if (m_inputManager) {
+                m_inputManager->setReplayActions(nullptr);
+            }
+            m_data.clear();
+        }
+
+        m_mode = Mode::Off;
+    }
+
+    void InputRecorder::attach(InputManager* inputManager) {
+        if (m_inputManager && isReplaying()) {
+            m_inputManager->setReplayActions(nullptr);
+        }
+        m_inputManager = inputManager;
+        if (m_inputManager && isReplaying()) {
+            m_inputManager->setReplayActions(&m_replayActions);
+        }
+    }
+
+    void InputRecorder::recordFrame(float deltaTime, const Input& input) {
+        if (!isRecording()) {
+            return;
+        }
+
+        FrameState frame;
+        frame.deltaTime = deltaTime;
+        sortedCopy(input.m_keysDown, frame.keysDown);
+        sortedCopy(input.m_keysPressed, frame.keysPressed);
+        sortedCopy(input.m_keysReleased, frame.keysReleased);
+        sortedCopy(input.m_mouseButtonsDown, frame.buttonsDown);
+        sortedCopy(input.m_mouseButtonsPressed, frame.buttonsPressed);
+        sortedCopy(input.m_mouseButtonsReleased, frame.buttonsReleased);
+        frame.mouseX = input.m_mouseX;
+        frame.mouseY = input.m_mouseY;
+        frame.mouseWheel = input.m_mouseWheel;
+
+        uint8_t bits = 0;
+        if (frame.keysDown != m_previous.keysDown) bits |= KeysDownChanged;
+        if (!frame.keysPressed.empty()) bits |= HasKeysPressed;
+        if (!frame.keysReleased.empty()) bits |= HasKeysReleased;
+        if (frame.buttonsDown != m_previous.buttonsDown) bits |= ButtonsDownChanged;
+        if (!frame.buttonsPressed.empty()) bits |= HasButtonsPressed;
+        if (!frame.buttonsReleased.empty()) bits |= HasButtonsReleased;
+        if (frame.mouseX != m_previous.mouseX || frame.mouseY != m_previous.mouseY) bits |= MouseMoved;
+        if (frame.mouseWheel != 0.0f) bits |= HasMouseWheel;
+
+        put(m_frames, bits);
+        put(m_frames, frame.deltaTime);
+        if (bits & KeysDownChanged) putList(m_frames, frame.keysDown);
+        if (bits & HasKeysPressed) putList(m_frames, frame.keysPressed);
+        if (bits & HasKeysReleased) putList(m_frames, frame.keysReleased);
+        if (bits & ButtonsDownChanged) putList(m_frames, frame.buttonsDown);
+        if (bits & HasButtonsPressed) putList(m_frames, frame.buttonsPressed);
+        if (bits & HasButtonsReleased) putList(m_frames, frame.buttonsReleased);
+        if (bits & MouseMoved) {
+            put(m_frames, frame.mouseX);
+            put(m_frames, frame.mouseY);
+        }
+        if (bits & HasMouseWheel) put(m_frames, frame.mouseWheel);
+
+        // Patched by endTick()
+        m_tickCountOffset = m_frames.size();
+        put(m_frames, static_cast<uint16_t>(0));
+
+        m_previous = std::move(frame);
+    }
+
+    void InputRecorder::beginTick() {
+        if (!isReplaying() || !m_inputManager) {
+            return;
+        }
+
+        if (m_tickIndex < m_tickActions.size()) {
+            m_replayActions = m_tickActions[m_tickIndex];
+        } else {
+            m_replayActions.clear();
+        }
+        m_tickIndex++;
+        m_inputManager->setReplayActions(&m_replayActions);
+    }
+
+    void InputRecorder::endTick() {
+        if (!isRecording()) {
+            return;
+        }
+
+        uint16_t tickCount = 0;
+        std::memcpy(&tickCount, m_frames.data() + m_tickCountOffset, sizeof(tickCount));
+        tickCount++;
+        std::memcpy(m_frames.data() + m_tickCountOffset, &tickCount, sizeof(tickCount));
+
+        if (!m_inputManager) {
+            put(m_frames, static_cast<uint16_t>(0));
+        } else {
+            // Sorted by name index so the encoding doesn't depend on hash order
+            std::vector<std::pair<uint16_t, const ActionValue*>> actions;
+            for (const auto& [name, value] : m_inputManager->getFrameActions()) {
+                actions.emplace_back(actionNameIndex(name), &value);
+            }
+            std::sort(actions.begin(), actions.end(),
+                      [](const auto& a, const auto& b) { return a.first < b.first; });
+
+            put(m_frames, static_cast<uint16_t>(actions.size()));
+            for (const auto& [index, value] : actions) {
+                bool hasAxes = value->axis1D != 0.0f || value->axis2DX != 0.0f || value->axis2DY != 0.0f;
+                uint8_t bits = static_cast<uint8_t>(value->type) & TypeMask;
+                if (value->buttonDown) bits |= ButtonDown;
+                if (value->buttonPressed) bits |= ButtonPressed;
+                if (value->buttonReleased) bits |= ButtonReleased;
+                if (hasAxes) bits |= HasAxes;
+
+                put(m_frames, index);
+                put(m_frames, bits);
+                if (hasAxes) {
+                    put(m_frames, value->axis1D);
+                    put(m_frames, value->axis2DX);
+                    put(m_frames, value->axis2DY);
+                }
+            }
+        }
+    }
+
+    void InputRecorder::endFrame() {
+        if (isRecording()) {
+            m_frameCount++;
+        }
+    }
+
+    bool InputRecorder::replayFrame(float& deltaTime, Input& input) {
+        if (!isReplaying()) {
+            return false;
+        }
+
+        auto now = std::chrono::steady_clock::now();
+        if (m_frameIndex > 0) {
+            m_frameTimesMs.push_back(std::chrono::duration<float, std::milli>(now - m_lastFrameTime).count());
+        }
+        m_lastFrameTime = now;
+
+        if (m_frameIndex >= m_frameCount || !readFrame(m_current)) {
+            if (m_frameIndex < m_frameCount) {
+                LOG_ERROR("Input recording {} is truncated at frame {}", m_filePath, m_frameIndex);
+            }
+            logReplaySummary();
+            stop();
+            return false;
+        }
+
+        deltaTime = m_current.deltaTime;
+        assignSet(input.m_keysDown, m_current.keysDown);
+        assignSet(input.m_keysPressed, m_current.keysPressed);
+        assignSet(input.m_keysReleased, m_current.keysReleased);
+        assignSet(input.m_mouseButtonsDown, m_current.buttonsDown);
+        assignSet(input.m_mouseButtonsPressed, m_current.buttonsPressed);
+        assignSet(input.m_mouseButtonsReleased, m_current.buttonsReleased);
+        input.m_mouseX = m_current.mouseX;
+        input.m_mouseY = m_current.mouseY;
+        input.m_mouseWheel = m_current.mouseWheel;
+
+        m_tickIndex = 0;
+        m_frameIndex++;
+        return true;
+    }
+
+    bool InputRecorder::readFrame(FrameState& frame) {
+        uint8_t bits = 0;
+        if (!get(m_data, m_cursor, bits) || !get(m_data, m_cursor, frame.deltaTime)) {
+            return false;
+        }
+
+        // Down sets and mouse position carry over from the previous frame unless changed
+        frame.keysPressed.clear();
+        frame.keysReleased.clear();
+        frame.buttonsPressed.clear();
+        frame.buttonsReleased.clear();
+        frame.mouseWheel = 0.0f;
+
+        bool ok = true;
+        if (ok && (bits & KeysDownChanged)) ok = getList(m_data, m_cursor, frame.keysDown);
+        if (ok && (bits & HasKeysPressed)) ok = getList(m_data, m_cursor, frame.keysPressed);
+        if (ok && (bits & HasKeysReleased)) ok = getList(m_data, m_cursor, frame.keysReleased);
+        if (ok && (bits & ButtonsDownChanged)) ok = getList(m_data, m_cursor, frame.buttonsDown);
+        if (ok && (bits & HasButtonsPressed)) ok = getList(m_data, m_cursor, frame.buttonsPressed);
+        if (ok && (bits & HasButtonsReleased)) ok = getList(m_data, m_cursor, frame.buttonsReleased);
+        if (ok && (bits & MouseMoved)) ok = get(m_data, m_cursor, frame.mouseX) && get(m_data, m_cursor, frame.mouseY);
+        if (ok && (bits & HasMouseWheel)) ok = get(m_data, m_cursor, frame.mouseWheel);
+
+        uint16_t tickCount = 0;
+        if (!ok || !get(m_data, m_cursor, tickCount)) {
+            return false;
+        }
+
+        m_tickActions.resize(tickCount);
+        for (auto& actions : m_tickActions) {
+            uint16_t actionCount = 0;
+            if (!get(m_data, m_cursor, actionCount)) {
+                return false;
+            }
+
+            actions.clear();
+            for (uint16_t i = 0; i < actionCount; ++i) {
+                uint16_t index = 0;
+                uint8_t actionBits = 0;
+                if (!get(m_data, m_cursor, index) || !get(m_data, m_cursor, actionBits) ||
+                    index >= m_actionNames.size()) {
+                    return false;
+                }
+
+                ActionValue value;
+                value.type = static_cast<ActionType>(actionBits & TypeMask);
+                value.buttonDown = (actionBits & ButtonDown) != 0;
+                value.buttonPressed = (actionBits & ButtonPressed) != 0;
+                value.buttonReleased = (actionBits & ButtonReleased) != 0;
+                if ((actionBits & HasAxes) &&
+                    !(get(m_data, m_cursor, value.axis1D) && get(m_data, m_cursor, value.axis2DX) &&
+                      get(m_data, m_cursor, value.axis2DY))) {
+                    return false;
+                }
+                actions[m_actionNames[index]] = value;
+            }
+        }
+
+        return true;
+    }
+
+    uint16_t InputRecorder::actionNameIndex(const std::string& name) {
+        auto it = m_actionIndices.find(name);
+        if (it != m_actionIndices.end()) {
+            return it->second;
+        }
+
+        uint16_t index = static_cast<uint16_t>(m_actionNames.size());
+        m_actionNames.push_back(name);
+        m_actionIndices.emplace(name, index);
+        return index;
+    }
+
+    void InputRecorder::logReplaySummary() const {
+        if (m_frameTimesMs.empty()) {
+            LOG_INFO("Replay finished: {} frames", m_frameIndex);
+            return;
+        }
+
+        std::vector<float> sorted = m_frameTimesMs;
+        std::sort(sorted.begin(), sorted.end());
+
+        double total = 0.0;
+        for (float ms : sorted) {
+            total += ms;
+        }
+
+        auto percentile = [&sorted](double p) {
+            size_t index = static_cast<size_t>(p * static_cast<double>(sorted.size() - 1) + 0.5);
+            return sorted[index];
+        };
+
+        LOG_INFO("Replay finished: {} frames in {:.2f} s", m_frameIndex, total / 1000.0);
+        LOG_INFO("  Frame time: avg {:.3f} ms | p50 {:.3f} ms | p95 {:.3f} ms | p99 {:.3f} ms | max {:.3f} ms",
+                 total / static_cast<double>(sorted.size()), percentile(0.50), percentile(0.95),
+                 percentile(0.99), sorted.back());
+    }
+
+}
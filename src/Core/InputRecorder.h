@@ -0,0 +1,140 @@
+// File: src/Core/InputRecorder.h
+
+/**
+ * InputRecorder.h
+ * Records the per-frame Input state, InputManager actions and delta time to a
+ * compact binary log, and feeds them back for deterministic replays.
+ */
+
+#ifndef RUNA_CORE_INPUTRECORDER_H
+#define RUNA_CORE_INPUTRECORDER_H
+
+#include "../RunaAPI.h"
+#include "InputAction.h"
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Runa {
+
+    class Input;
+    class InputManager;
+
+    /**
+     * InputRecorder - Session capture for reproducible runs.
+     *
+     * A replay feeds back the recorded dt instead of wall-clock time, overwrites
+     * Input with the recorded state and serves InputManager actions from the log
+     * (bindings are not re-evaluated). Together with the recorded Random::game()
+     * seed, the simulation sees exactly the same inputs as the recorded session,
+     * so a replay doubles as a benchmark: it runs as fast as the frame allows and
+     * logs frame time statistics when the log ends.
+     *
+     * Application drives the recorder; games only attach their InputManager.
+     */
+    class RUNA_API InputRecorder {
+    public:
+        enum class Mode { Off, Recording, Replaying };
+
+        using ActionMap = std::unordered_map<std::string, ActionValue>;
+
+        InputRecorder() = default;
+        ~InputRecorder();
+
+        InputRecorder(const InputRecorder&) = delete;
+        InputRecorder& operator=(const InputRecorder&) = delete;
+
+        // Start recording; the log is written to filePath by stop()
+        bool startRecording(const std::string& filePath);
+
+        // Load a log written by a previous recording
+        bool startReplay(const std::string& filePath);
+
+        // Finish the session (writes the log when recording)
+        void stop();
+
+        // Actions of this manager are recorded and replayed; nullptr detaches
+        void attach(InputManager* inputManager);
+
+        Mode getMode() const { return m_mode; }
+        bool isRecording() const { return m_mode == Mode::Recording; }
+        bool isReplaying() const { return m_mode == Mode::Replaying; }
+
+        // Seed for Random::game(); set by Application when recording, read from the log when replaying
+        uint64_t getSeed() const { return m_seed; }
+        void setSeed(uint64_t seed) { m_seed = seed; }
+
+        /**
+         * Recording: capture this frame's dt and Input state. Call after events
+         * are processed and before the frame's first tick.
+         */
+        void recordFrame(float deltaTime, const Input& input);
+
+        // Replaying: serve the next tick's recorded actions to the attached InputManager
+        void beginTick();
+
+        // Recording: capture the actions the attached InputManager evaluated this tick
+        void endTick();
+
+        // Recording: close the frame started by recordFrame()
+        void endFrame();
+
+        /**
+         * Replaying: load the next frame into deltaTime and input.
+         * @return false when the log is exhausted (the summary has been logged)
+         */
+        bool replayFrame(float& deltaTime, Input& input);
+
+        uint32_t getFrameIndex() const { return m_frameIndex; }
+        uint32_t getFrameCount() const { return m_frameCount; }
+
+    private:
+        struct FrameState {
+            float deltaTime = 0.0f;
+            std::vector<int32_t> keysDown;
+            std::vector<int32_t> keysPressed;
+            std::vector<int32_t> keysReleased;
+            std::vector<uint8_t> buttonsDown;
+            std::vector<uint8_t> buttonsPressed;
+            std::vector<uint8_t> buttonsReleased;
+            int32_t mouseX = 0;
+            int32_t mouseY = 0;
+            float mouseWheel = 0.0f;
+        };
+
+        bool readFrame(FrameState& frame);
+        uint16_t actionNameIndex(const std::string& name);
+        void logReplaySummary() const;
+
+        Mode m_mode = Mode::Off;
+        std::string m_filePath;
+        uint64_t m_seed = 0;
+        InputManager* m_inputManager = nullptr;
+
+        // Recording: encoded frames; header and action names are written by stop()
+        std::vector<uint8_t> m_frames;
+        size_t m_tickCountOffset = 0;
+        std::vector<std::string> m_actionNames;
+        std::unordered_map<std::string, uint16_t> m_actionIndices;
+        FrameState m_previous;
+
+        // Replaying: whole file in memory, decoded one frame at a time
+        std::vector<uint8_t> m_data;
+        size_t m_cursor = 0;
+        FrameState m_current;
+        std::vector<ActionMap> m_tickActions;   // One per tick of the current frame
+        size_t m_tickIndex = 0;
+        ActionMap m_replayActions;
+
+        uint32_t m_frameIndex = 0;
+        uint32_t m_frameCount = 0;
+
+        std::chrono::steady_clock::time_point m_lastFrameTime;
+        std::vector<float> m_frameTimesMs;
+    };
+
+}
+
+#endif // RUNA_CORE_INPUTRECORDER_H
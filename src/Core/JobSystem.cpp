@@ -0,0 +1,356 @@
+// File: src/Core/JobSystem.cpp
+
+/**
+ * JobSystem.cpp
+ * Worker threads, work-stealing deques and job counters.
+ */
+
+#include "../runapch.h"
+#include "JobSystem.h"
+#include "Log.h"
+#include <condition_variable>
+#include <deque>
+
+namespace Runa {
+
+    struct Job {
+        JobSystem::Function function;
+        JobCounter* counter = nullptr;
+    };
+
+    namespace {
+
+        /**
+         * Fixed-size Chase-Lev deque (Le et al., "Correct and Efficient Work-Stealing
+         * for Weak Memory Models"). The owning thread pushes and pops at the bottom;
+         * other threads steal from the top.
+         */
+        class WorkStealingQueue {
+        public:
+            static constexpr int64_t Capacity = 4096;
+
+            // Owner only. Returns false when full; the caller falls back to the shared queue
+            bool push(Job* job) {
+                const int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+                const int64_t top = m_top.load(std::memory_order_acquire);
+                if (bottom - top >= Capacity) {
+                    return false;
+                }
+
+                m_jobs[bottom & (Capacity - 1)].store(job, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_release);
+                m_bottom.store(bottom + 1, std::memory_order_relaxed);
+                return true;
+            }
+
+            // Owner only. Newest first, so a thread keeps working on hot data
+            Job* pop() {
+                const int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+                m_bottom.store(bottom, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                int64_t top = m_top.load(std::memory_order_relaxed);
+
+                if (top > bottom) {
+                    m_bottom.store(bottom + 1, std::memory_order_relaxed);
+                    return nullptr;
+                }
+
+                Job* job = m_jobs[bottom & (Capacity - 1)].load(std::memory_order_relaxed);
+                if (top == bottom) {
+                    // Last job: race thieves for it
+                    if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                                       std::memory_order_relaxed)) {
+                        job = nullptr;
+                    }
+                    m_bottom.store(bottom + 1, std::memory_order_relaxed);
+                }
+                return job;
+            }
+
+            // Any thread. Oldest first
+            Job* steal() {
+                int64_t top = m_top.load(std::memory_order_acquire);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                const int64_t bottom = m_bottom.load(std::memory_order_acquire);
+                if (top >= bottom) {
+                    return nullptr;
+                }
+
+                Job* job = m_jobs[top & (Capacity - 1)].load(std::memory_order_relaxed);
+                if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                                   std::memory_order_relaxed)) {
+                    return nullptr;
+                }
+                return job;
+            }
+
+        private:
+            // Separate cache lines: thieves hammer m_top, the owner m_bottom
+            alignas(64) std::atomic<int64_t> m_top{0};
+            alignas(64) std::atomic<int64_t> m_bottom{0};
+            std::array<std::atomic<Job*>, Capacity> m_jobs{};
+        };
+
+        // [0] belongs to the thread that called init(), [1..] to the workers
+        std::vector<std::unique_ptr<WorkStealingQueue>> s_queues;
+        std::vector<std::thread> s_threads;
+
+        // Jobs submitted from threads without a deque
+        std::mutex s_sharedMutex;
+        std::deque<Job*> s_sharedQueue;
+
+        std::atomic<int> s_queuedJobs{0};       // Waiting in a deque or the shared queue
+        std::atomic<int> s_liveJobs{0};         // Created and not yet finished, including held continuations
+        std::atomic<int> s_sleepingWorkers{0};
+        std::atomic<bool> s_quit{false};
+        std::mutex s_sleepMutex;
+        std::condition_variable s_wake;
+
+        thread_local int t_queueIndex = -1;
+        thread_local uint32_t t_stealSeed = 0;
+
+        Job* takeShared() {
+            std::lock_guard<std::mutex> lock(s_sharedMutex);
+            if (s_sharedQueue.empty()) {
+                return nullptr;
+            }
+            Job* job = s_sharedQueue.front();
+            s_sharedQueue.pop_front();
+            return job;
+        }
+
+        Job* stealFromOthers() {
+            const uint32_t queueCount = static_cast<uint32_t>(s_queues.size());
+
+            // Random starting victim so thieves spread out
+            t_stealSeed = t_stealSeed * 1664525u + 1013904223u;
+            const uint32_t start = (t_stealSeed >> 16) % queueCount;
+
+            for (uint32_t i = 0; i < queueCount; ++i) {
+                const uint32_t victim = (start + i) % queueCount;
+                if (static_cast<int>(victim) == t_queueIndex) {
+                    continue;
+                }
+                if (Job* job = s_queues[victim]->steal()) {
+                    return job;
+                }
+            }
+            return nullptr;
+        }
+
+        void stopWorkers() {
+            {
+                std::lock_guard<std::mutex> lock(s_sleepMutex);
+                s_quit.store(true);
+            }
+            s_wake.notify_all();
+
+            for (auto& thread : s_threads) {
+                thread.join();
+            }
+            s_threads.clear();
+            s_queues.clear();
+        }
+
+        // Joins the workers if shutdown() was never reached (an exception escaped
+        // Application's constructor), instead of terminating on joinable threads.
+        // Defined after the queues, so it is destroyed before them
+        struct WorkerGuard {
+            ~WorkerGuard() {
+                if (!s_threads.empty()) {
+                    stopWorkers();
+                }
+            }
+        } s_workerGuard;
+
+    }
+
+    std::atomic<bool> JobSystem::s_running{false};
+    int JobSystem::s_workerCount = 0;
+
+    void JobSystem::init(int workerCount) {
+        if (isRunning()) {
+            LOG_WARN("JobSystem already initialized with {} workers", s_workerCount);
+            return;
+        }
+
+        if (workerCount < 0) {
+            const unsigned cores = std::thread::hardware_concurrency();
+            workerCount = cores > 1 ? static_cast<int>(cores) - 1 : 0;
+        }
+        if (workerCount == 0) {
+            LOG_INFO("JobSystem: No worker threads, jobs run inline");
+            return;
+        }
+
+        s_queues.clear();
+        for (int i = 0; i <= workerCount; ++i) {
+            s_queues.push_back(std::make_unique<WorkStealingQueue>());
+        }
+
+        s_quit.store(false);
+        s_workerCount = workerCount;
+        t_queueIndex = 0;
+        s_running.store(true, std::memory_order_release);
+
+        for (int i = 1; i <= workerCount; ++i) {
+            s_threads.emplace_back(&JobSystem::workerMain, i);
+        }
+
+        LOG_INFO("JobSystem: Started {} worker threads", workerCount);
+    }
+
+    void JobSystem::shutdown() {
+        if (!isRunning()) {
+            return;
+        }
+
+        // Finish everything queued, including jobs those jobs submit
+        while (s_liveJobs.load(std::memory_order_acquire) > 0) {
+            if (!runOneJob()) {
+                std::this_thread::yield();
+            }
+        }
+
+        stopWorkers();
+
+        s_running.store(false, std::memory_order_release);
+        s_workerCount = 0;
+        t_queueIndex = -1;
+
+        LOG_INFO("JobSystem: Shut down");
+    }
+
+    bool JobSystem::isJobThread() {
+        return isRunning() && t_queueIndex >= 0;
+    }
+
+    void JobSystem::run(Function function, JobCounter* counter, JobCounter* dependency) {
+        if (counter) {
+            counter->m_pending.fetch_add(1, std::memory_order_acq_rel);
+        }
+
+        if (!isRunning()) {
+            function();
+            if (counter) {
+                finish(*counter);
+            }
+            return;
+        }
+
+        s_liveJobs.fetch_add(1, std::memory_order_acq_rel);
+        Job* job = new Job{std::move(function), counter};
+
+        if (dependency) {
+            // Same lock as the dependency's final decrement, so the job is either
+            // held here or submitted now, never lost in between
+            std::lock_guard<std::mutex> lock(dependency->m_mutex);
+            if (dependency->m_pending.load(std::memory_order_acquire) > 0) {
+                dependency->m_continuations.push_back(job);
+                return;
+            }
+        }
+
+        submit(job);
+    }
+
+    void JobSystem::wait(JobCounter& counter) {
+        while (!counter.isDone()) {
+            if (!runOneJob()) {
+                std::this_thread::yield();
+            }
+        }
+
+        // The finishing job decrements under this lock; taking it once means it has let go
+        std::lock_guard<std::mutex> lock(counter.m_mutex);
+    }
+
+    bool JobSystem::runOneJob() {
+        if (!isRunning()) {
+            return false;
+        }
+
+        Job* job = nullptr;
+        if (t_queueIndex >= 0) {
+            job = s_queues[t_queueIndex]->pop();
+        }
+        if (!job) {
+            job = takeShared();
+        }
+        if (!job) {
+            job = stealFromOthers();
+        }
+        if (!job) {
+            return false;
+        }
+
+        execute(job);
+        return true;
+    }
+
+    void JobSystem::execute(Job* job) {
+        s_queuedJobs.fetch_sub(1, std::memory_order_acq_rel);
+
+        job->function();
+        if (job->counter) {
+            finish(*job->counter);
+        }
+        delete job;
+
+        s_liveJobs.fetch_sub(1, std::memory_order_acq_rel);
+    }
+
+    void JobSystem::submit(Job* job) {
+        s_queuedJobs.fetch_add(1, std::memory_order_seq_cst);
+
+        if (t_queueIndex < 0 || !s_queues[t_queueIndex]->push(job)) {
+            std::lock_guard<std::mutex> lock(s_sharedMutex);
+            s_sharedQueue.push_back(job);
+        }
+
+        // Workers register as sleeping before re-checking s_queuedJobs, so this can't miss one
+        if (s_sleepingWorkers.load(std::memory_order_seq_cst) > 0) {
+            { std::lock_guard<std::mutex> lock(s_sleepMutex); }
+            s_wake.notify_one();
+        }
+    }
+
+    void JobSystem::finish(JobCounter& counter) {
+        std::vector<Job*> ready;
+        {
+            std::lock_guard<std::mutex> lock(counter.m_mutex);
+            if (counter.m_pending.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+                return;
+            }
+            ready.swap(counter.m_continuations);
+        }
+
+        // The counter may already be gone; only the detached continuations are touched
+        for (Job* job : ready) {
+            submit(job);
+        }
+    }
+
+    void JobSystem::workerMain(int index) {
+        t_queueIndex = index;
+        t_stealSeed = static_cast<uint32_t>(index) * 2654435761u;
+
+        while (true) {
+            if (runOneJob()) {
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(s_sleepMutex);
+            s_sleepingWorkers.fetch_add(1, std::memory_order_seq_cst);
+            s_wake.wait(lock, [] {
+                return s_queuedJobs.load(std::memory_order_seq_cst) > 0 || s_quit.load();
+            });
+            s_sleepingWorkers.fetch_sub(1, std::memory_order_seq_cst);
+
+            if (s_quit.load() && s_queuedJobs.load() == 0) {
+                return;
+            }
+        }
+    }
+
+}
@@ -0,0 +1,133 @@
+// File: src/Core/JobSystem.h
+
+/**
+ * JobSystem.h
+ * Engine-wide work-stealing job system: one worker per core, each with a
+ * Chase-Lev deque, job counters with continuations, and parallelFor.
+ */
+
+#ifndef RUNA_CORE_JOBSYSTEM_H
+#define RUNA_CORE_JOBSYSTEM_H
+
+#include "../RunaAPI.h"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+namespace Runa {
+
+    struct Job;
+
+    /**
+     * JobCounter - Number of unfinished jobs submitted against it.
+     * Jobs can be made to start only once a counter reaches zero (see JobSystem::run).
+     * A counter must be passed to JobSystem::wait() before it is destroyed, so the
+     * last finishing job has released it.
+     */
+    class RUNA_API JobCounter {
+    public:
+        JobCounter() = default;
+        ~JobCounter() = default;
+
+        JobCounter(const JobCounter&) = delete;
+        JobCounter& operator=(const JobCounter&) = delete;
+
+        bool isDone() const { return m_pending.load(std::memory_order_acquire) == 0; }
+        int getPending() const { return m_pending.load(std::memory_order_acquire); }
+
+    private:
+        friend class JobSystem;
+
+        std::atomic<int> m_pending{0};
+        std::mutex m_mutex;                     // Guards m_continuations and the final decrement
+        std::vector<Job*> m_continuations;      // Jobs waiting for this counter to reach zero
+    };
+
+    /**
+     * JobSystem - Global worker pool.
+     *
+     * The thread that calls init() (the main thread) gets a deque of its own and
+     * runs jobs while it waits. Any other thread may submit and wait too; its jobs
+     * go through a shared queue. Jobs must not throw, and must not block on
+     * anything but wait().
+     *
+     * Before init() and after shutdown(), run() executes jobs inline, so tools
+     * and tests work without starting any threads.
+     */
+    class RUNA_API JobSystem {
+    public:
+        using Function = std::function<void()>;
+
+        /**
+         * Start the workers.
+         * @param workerCount Number of worker threads; < 0 uses one per core minus the main thread
+         */
+        static void init(int workerCount = -1);
+
+        // Run every queued job to completion, then join the workers
+        static void shutdown();
+
+        static bool isRunning() { return s_running.load(std::memory_order_acquire); }
+        static int getWorkerCount() { return s_workerCount; }
+
+        // True on a pool worker or the thread that called init()
+        static bool isJobThread();
+
+        /**
+         * Queue a job.
+         * @param counter Incremented now, decremented when the job finishes (may be nullptr)
+         * @param dependency If not nullptr, the job is held back until this counter reaches zero
+         */
+        static void run(Function function, JobCounter* counter = nullptr, JobCounter* dependency = nullptr);
+
+        // Run other jobs until counter reaches zero
+        static void wait(JobCounter& counter);
+
+        /**
+         * Split [0, count) into chunks of grainSize and call function(begin, end) on each
+         * across the pool; returns when every chunk is done. A grainSize of 0 picks
+         * about four chunks per thread.
+         */
+        template<typename Body>
+        static void parallelFor(size_t count, size_t grainSize, Body&& function) {
+            if (count == 0) {
+                return;
+            }
+
+            const size_t threads = static_cast<size_t>(getWorkerCount()) + 1;
+            if (grainSize == 0) {
+                grainSize = std::max<size_t>(1, count / (threads * 4));
+            }
+            if (!isRunning() || count <= grainSize) {
+                function(size_t{0}, count);
+                return;
+            }
+
+            JobCounter counter;
+            for (size_t begin = grainSize; begin < count; begin += grainSize) {
+                const size_t end = std::min(count, begin + grainSize);
+                run([&function, begin, end]() { function(begin, end); }, &counter);
+            }
+
+            // The first chunk runs here rather than sitting in the queue
+            function(size_t{0}, grainSize);
+            wait(counter);
+        }
+
+    private:
+        static bool runOneJob();
+        static void execute(Job* job);
+        static void submit(Job* job);
+        static void finish(JobCounter& counter);
+        static void workerMain(int index);
+
+        static std::atomic<bool> s_running;
+        static int s_workerCount;
+    };
+
+}
+
+#endif // RUNA_CORE_JOBSYSTEM_H
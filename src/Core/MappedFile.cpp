@@ -0,0 +1,147 @@
+// File: src/Core/MappedFile.cpp
+
+/**
+ * MappedFile.cpp
+ * Platform implementations of the read-only file mapping.
+ */
+
+#include "../runapch.h"
+#include "MappedFile.h"
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Runa {
+
+    MappedFile::~MappedFile() {
+        close();
+    }
+
+    MappedFile::MappedFile(MappedFile&& other) noexcept {
+        *this = std::move(other);
+    }
+
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+        if (this != &other) {
+            close();
+            m_data = std::exchange(other.m_data, nullptr);
+            m_size = std::exchange(other.m_size, 0);
+#ifdef _WIN32
+            m_file = std::exchange(other.m_file, nullptr);
+            m_mapping = std::exchange(other.m_mapping, nullptr);
+#else
+            m_fd = std::exchange(other.m_fd, -1);
+#endif
+        }
+        return *this;
+    }
+
+#ifdef _WIN32
+
+    bool MappedFile::open(const std::string& filePath) {
+        close();
+
+        HANDLE file = CreateFileA(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                  OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            return false;
+        }
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+            CloseHandle(file);
+            return false;
+        }
+
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping) {
+            CloseHandle(file);
+            return false;
+        }
+
+        void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (!view) {
+            CloseHandle(mapping);
+            CloseHandle(file);
+            return false;
+        }
+
+        m_file = file;
+        m_mapping = mapping;
+        m_data = static_cast<const std::byte*>(view);
+        m_size = static_cast<size_t>(fileSize.QuadPart);
+        return true;
+    }
+
+    void MappedFile::close() {
+        if (m_data) {
+            UnmapViewOfFile(m_data);
+        }
+        if (m_mapping) {
+            CloseHandle(m_mapping);
+        }
+        if (m_file) {
+            CloseHandle(m_file);
+        }
+        m_data = nullptr;
+        m_size = 0;
+        m_mapping = nullptr;
+        m_file = nullptr;
+    }
+
+#else
+
+    bool MappedFile::open(const std::string& filePath) {
+        close();
+
+        int fd = ::open(filePath.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return false;
+        }
+
+        struct stat info;
+        if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+            ::close(fd);
+            return false;
+        }
+
+        size_t size = static_cast<size_t>(info.st_size);
+        void* view = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (view == MAP_FAILED) {
+            ::close(fd);
+            return false;
+        }
+
+        m_fd = fd;
+        m_data = static_cast<const std::byte*>(view);
+        m_size = size;
+        return true;
+    }
+
+    void MappedFile::close() {
+        if (m_data) {
+            munmap(const_cast<std::byte*>(m_data), m_size);
+        }
+        if (m_fd >= 0) {
+            ::close(m_fd);
+        }
+        m_data = nullptr;
+        m_size = 0;
+        m_fd = -1;
+    }
+
+#endif
+
+}
@@ -0,0 +1,58 @@
+// File: src/Core/MappedFile.h
+
+/**
+ * MappedFile.h
+ * Read-only memory-mapped file (mmap on POSIX, file mappings on Windows).
+ */
+
+#ifndef RUNA_CORE_MAPPEDFILE_H
+#define RUNA_CORE_MAPPEDFILE_H
+
+#include "../RunaAPI.h"
+#include <cstddef>
+#include <string>
+
+namespace Runa {
+
+    /**
+     * MappedFile - Maps a whole file read-only for the lifetime of the object.
+     * The mapping is page-aligned, so data() is suitably aligned for any
+     * fundamental type at offsets that are multiples of its alignment.
+     */
+    class RUNA_API MappedFile {
+    public:
+        MappedFile() = default;
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        MappedFile(MappedFile&& other) noexcept;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+
+        /**
+         * Map a file. Does not log; callers decide whether a missing file is an error.
+         * @return false if the file doesn't exist, is empty or can't be mapped
+         */
+        bool open(const std::string& filePath);
+        void close();
+
+        bool isOpen() const { return m_data != nullptr; }
+        const std::byte* data() const { return m_data; }
+        size_t size() const { return m_size; }
+
+    private:
+        const std::byte* m_data = nullptr;
+        size_t m_size = 0;
+
+#ifdef _WIN32
+        void* m_file = nullptr;
+        void* m_mapping = nullptr;
+#else
+        int m_fd = -1;
+#endif
+    };
+
+}
+
+#endif // RUNA_CORE_MAPPEDFILE_H
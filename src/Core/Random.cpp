@@ -0,0 +1,62 @@
+// File: src/Core/Random.cpp
+
+/**
+ * Random.cpp
+ * PCG32 (XSH RR) implementation.
+ */
+
+#include "../runapch.h"
+#include "Random.h"
+
+namespace Runa {
+
+    void Random::setSeed(uint64_t seed) {
+        m_seed = seed;
+        m_state = 0;
+        m_increment = (seed << 1u) | 1u;
+        next();
+        m_state += seed;
+        next();
+    }
+
+    uint32_t Random::next() {
+        uint64_t old = m_state;
+        m_state = old * 6364136223846793005ull + m_increment;
+        uint32_t xorShifted = static_cast<uint32_t>(((old >> 18u) ^ old) >> 27u);
+        uint32_t rotation = static_cast<uint32_t>(old >> 59u);
+        return (xorShifted >> rotation) | (xorShifted << ((32u - rotation) & 31u));
+    }
+
+    int Random::range(int min, int max) {
+        if (max <= min) {
+            return min;
+        }
+
+        // Rejection sampling keeps the distribution uniform
+        uint32_t span = static_cast<uint32_t>(static_cast<int64_t>(max) - min) + 1u;
+        if (span == 0) {
+            return static_cast<int>(next());  // Full 32-bit range
+        }
+        uint32_t threshold = (0u - span) % span;
+        uint32_t value;
+        do {
+            value = next();
+        } while (value < threshold);
+        return static_cast<int>(static_cast<int64_t>(min) + value % span);
+    }
+
+    float Random::range(float min, float max) {
+        return min + (max - min) * unit();
+    }
+
+    float Random::unit() {
+        // 24 random bits fill a float mantissa exactly
+        return static_cast<float>(next() >> 8) * (1.0f / 16777216.0f);
+    }
+
+    Random& Random::game() {
+        static Random instance;
+        return instance;
+    }
+
+}
@@ -0,0 +1,54 @@
+// File: src/Core/Random.h
+
+/**
+ * Random.h
+ * Small deterministic random number generator (PCG32). Gameplay code draws
+ * from Random::game() instead of rand() so a recorded session replays with
+ * the same numbers.
+ */
+
+#ifndef RUNA_CORE_RANDOM_H
+#define RUNA_CORE_RANDOM_H
+
+#include "../RunaAPI.h"
+#include <cstdint>
+
+namespace Runa {
+
+    /**
+     * Random - PCG32 generator. Identical seeds give identical sequences on
+     * every platform. Not thread-safe; give each thread its own instance.
+     */
+    class RUNA_API Random {
+    public:
+        explicit Random(uint64_t seed = 0x853C49E6748FEA9Bull) { setSeed(seed); }
+
+        void setSeed(uint64_t seed);
+        uint64_t getSeed() const { return m_seed; }
+
+        uint32_t next();
+
+        // Uniform integer in [min, max]
+        int range(int min, int max);
+
+        // Uniform float in [min, max)
+        float range(float min, float max);
+
+        // Uniform float in [0, 1)
+        float unit();
+
+        /**
+         * Shared simulation generator. Application seeds it before onInit(),
+         * from the replay log when replaying (see InputRecorder).
+         */
+        static Random& game();
+
+    private:
+        uint64_t m_seed = 0;
+        uint64_t m_state = 0;
+        uint64_t m_increment = 0;
+    };
+
+}
+
+#endif // RUNA_CORE_RANDOM_H
@@ -25,4 +25,8 @@ namespace Runa {
 		return m_app.getInput();
 	}
 
+	float Scene::getInterpolationAlpha() const {
+		return m_app.getInterpolationAlpha();
+	}
+
 }
@@ -10,6 +10,7 @@
 #define RUNA_CORE_SCENE_H
 
 #include "../RunaAPI.h"
+#include "../Graphics/RenderSnapshot.h"
 #include <string>
 
 namespace Runa {
@@ -42,11 +43,27 @@ namespace Runa {
 		virtual void onUpdate(float dt) = 0;
 		virtual void onRender() = 0;
 
+		/**
+		 * Copy what onRender needs out of the simulation. Called once per frame
+		 * after the frame's ticks, on the simulation thread when Application is
+		 * pipelined. snapshot.interpolationAlpha is already set.
+		 */
+		virtual void onExtract(RenderSnapshot& snapshot) {}
+
 
 		const std::string& getName() const { return m_name; }
 		std::string getType() const { return m_type; }
 		bool isTransparent() const { return m_transparent; }
 		void setTransparent(bool transparent) { m_transparent = transparent; }
+
+		// Pipeline-safe scenes only read getRenderSnapshot() and render-side resources in onRender
+		bool isPipelineSafe() const { return m_pipelineSafe; }
+		void setPipelineSafe(bool pipelineSafe) { m_pipelineSafe = pipelineSafe; }
+
+		// Double-buffered snapshots, flipped by SceneManager::publishSnapshots()
+		RenderSnapshot& getExtractSnapshot() { return m_snapshots[1 - m_renderSnapshot]; }
+		const RenderSnapshot& getRenderSnapshot() const { return m_snapshots[m_renderSnapshot]; }
+		void swapSnapshots() { m_renderSnapshot = 1 - m_renderSnapshot; }
 		
 		// For serialization
 		virtual ECS::EntityRegistry* getRegistry() { return nullptr; }
@@ -57,12 +74,18 @@ namespace Runa {
 		Renderer& getRenderer();
 		Input& getInput();
 
+		// Render-time blend between the previous and current tick (see Application::getInterpolationAlpha)
+		float getInterpolationAlpha() const;
+
 		std::string m_name;
 		std::string m_type;
 		bool m_transparent = false;
+		bool m_pipelineSafe = false;
 
 	private:
 		Application& m_app;
+		RenderSnapshot m_snapshots[2];
+		int m_renderSnapshot = 0;
 	};
 
 }
@@ -16,6 +16,10 @@ namespace Runa {
 			LOG_ERROR("Cannot push null scene");
 			return;
 		}
+		if (m_deferTransitions) {
+			m_pendingTransitions.push_back({TransitionType::Push, std::move(scene)});
+			return;
+		}
 
 
 		if (!m_scenes.empty()) {
@@ -28,6 +32,10 @@ namespace Runa {
 	}
 
 	void SceneManager::popScene() {
+		if (m_deferTransitions) {
+			m_pendingTransitions.push_back({TransitionType::Pop, nullptr});
+			return;
+		}
 		if (m_scenes.empty()) {
 			LOG_WARN("Cannot pop scene: stack is empty");
 			return;
@@ -48,6 +56,10 @@ namespace Runa {
 			LOG_ERROR("Cannot change to null scene");
 			return;
 		}
+		if (m_deferTransitions) {
+			m_pendingTransitions.push_back({TransitionType::Change, std::move(scene)});
+			return;
+		}
 
 
 		if (!m_scenes.empty()) {
@@ -64,6 +76,10 @@ namespace Runa {
 	}
 
 	void SceneManager::clearScenes() {
+		if (m_deferTransitions) {
+			m_pendingTransitions.push_back({TransitionType::Clear, nullptr});
+			return;
+		}
 		LOG_INFO("Clearing all scenes");
 		while (!m_scenes.empty()) {
 			m_scenes.back()->onExit();
@@ -82,20 +98,69 @@ namespace Runa {
 		if (m_scenes.empty()) return;
 
 
-		size_t startIndex = m_scenes.size() - 1;
+		for (size_t i = getFirstRenderedScene(); i < m_scenes.size(); ++i) {
+			m_scenes[i]->onRender();
+		}
+	}
 
+	void SceneManager::extract(float interpolationAlpha) {
+		if (m_scenes.empty()) return;
 
-		for (int i = static_cast<int>(m_scenes.size()) - 1; i >= 0; --i) {
-			if (!m_scenes[i]->isTransparent()) {
-				startIndex = i;
-				break;
+		for (size_t i = getFirstRenderedScene(); i < m_scenes.size(); ++i) {
+			RenderSnapshot& snapshot = m_scenes[i]->getExtractSnapshot();
+			snapshot.clear();
+			snapshot.interpolationAlpha = interpolationAlpha;
+			m_scenes[i]->onExtract(snapshot);
+		}
+	}
+
+	void SceneManager::publishSnapshots() {
+		if (m_scenes.empty()) return;
+
+		for (size_t i = getFirstRenderedScene(); i < m_scenes.size(); ++i) {
+			m_scenes[i]->swapSnapshots();
+		}
+	}
+
+	bool SceneManager::isPipelineSafe() const {
+		if (m_scenes.empty()) return false;
+
+		for (size_t i = getFirstRenderedScene(); i < m_scenes.size(); ++i) {
+			if (!m_scenes[i]->isPipelineSafe()) {
+				return false;
 			}
 		}
+		return true;
+	}
 
+	bool SceneManager::applyPendingTransitions() {
+		if (m_pendingTransitions.empty()) {
+			return false;
+		}
 
-		for (size_t i = startIndex; i < m_scenes.size(); ++i) {
-			m_scenes[i]->onRender();
+		// Moved out first: a scene's onEnter/onExit may queue further transitions
+		auto pending = std::move(m_pendingTransitions);
+		m_pendingTransitions.clear();
+
+		for (auto& transition : pending) {
+			switch (transition.type) {
+				case TransitionType::Push:   pushScene(std::move(transition.scene)); break;
+				case TransitionType::Pop:    popScene(); break;
+				case TransitionType::Change: changeScene(std::move(transition.scene)); break;
+				case TransitionType::Clear:  clearScenes(); break;
+			}
+		}
+		return true;
+	}
+
+	// The topmost opaque scene and everything above it are drawn
+	size_t SceneManager::getFirstRenderedScene() const {
+		for (int i = static_cast<int>(m_scenes.size()) - 1; i >= 0; --i) {
+			if (!m_scenes[i]->isTransparent()) {
+				return static_cast<size_t>(i);
+			}
 		}
+		return m_scenes.size() - 1;
 	}
 
 	Scene* SceneManager::getCurrentScene() const {
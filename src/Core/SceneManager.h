@@ -35,13 +35,40 @@ namespace Runa {
 		void update(float dt);
 		void render();
 
+		// Fill each rendered scene's extract snapshot (see Scene::onExtract)
+		void extract(float interpolationAlpha);
+
+		// Make the extracted snapshots the ones onRender reads
+		void publishSnapshots();
+
+		// True if every rendered scene can render while the next frame simulates
+		bool isPipelineSafe() const;
+
+		// While deferring, push/pop/change/clear are queued instead of applied,
+		// so the render thread never sees a scene destroyed under it
+		void setDeferTransitions(bool defer) { m_deferTransitions = defer; }
+
+		// Apply queued transitions in order; returns true if the stack changed
+		bool applyPendingTransitions();
+
 
 		Scene* getCurrentScene() const;
 		bool hasScenes() const { return !m_scenes.empty(); }
 		size_t getSceneCount() const { return m_scenes.size(); }
 
 	private:
+		enum class TransitionType { Push, Pop, Change, Clear };
+
+		struct PendingTransition {
+			TransitionType type;
+			std::unique_ptr<Scene> scene;
+		};
+
+		size_t getFirstRenderedScene() const;
+
 		std::vector<std::unique_ptr<Scene>> m_scenes;
+		std::vector<PendingTransition> m_pendingTransitions;
+		bool m_deferTransitions = false;
 	};
 
 }
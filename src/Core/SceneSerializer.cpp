@@ -2,24 +2,355 @@
 
 /**
  * SceneSerializer.cpp
- * Implementation of scene serialization to/from YAML.
+ * Implementation of scene serialization to/from YAML and the binary scene format.
  */
 
 #include "../runapch.h"
 #include "SceneSerializer.h"
 #include "Scene.h"
 #include "Log.h"
+#include "MappedFile.h"
+#include "StringPool.h"
 #include "../ECS/Components.h"
 #include "../ECS/RPGComponents.h"
 #include "../ECS/Registry.h"
+#include "../ECS/Reflection.h"
 #include "../Scenes/TestScene.h"
 #include <yaml-cpp/yaml.h>
+#include <algorithm>
 #include <fstream>
 #include <sstream>
 #include <entt/entt.hpp>
 
 namespace Runa {
 
+    namespace {
+
+        constexpr const char* SceneBinaryExtension = ".rscn";
+        constexpr uint32_t SceneMagic = 0x4E435352;  // "RSCN"
+        // Bump whenever a column's component layout changes; stale caches are then rebuilt from YAML
+        constexpr uint16_t SceneFormatVersion = 2;  // 2: Position gained prevX/prevY
+        constexpr size_t SceneBlockAlignment = 16;
+        constexpr uint32_t MaxSceneEntities = 1u << 24;   // Upper bound accepted from a file header
+
+        struct SceneFileHeader {
+            uint32_t magic = SceneMagic;
+            uint16_t version = SceneFormatVersion;
+            uint16_t blockCount = 0;
+            uint32_t entityCount = 0;
+            uint32_t stringCount = 0;       // Including the empty string at index 0
+            uint64_t sourceStamp = 0;       // Write time of the YAML source, 0 if none
+            uint32_t sceneName = 0;         // String table indices
+            uint32_t sceneType = 0;
+            uint64_t stringTableOffset = 0; // uint32 offsets[stringCount + 1], then characters
+            uint64_t blocksOffset = 0;      // ColumnBlockHeader[blockCount]
+        };
+
+        struct ColumnBlockHeader {
+            uint32_t column = 0;            // SceneColumn
+            uint32_t count = 0;
+            uint32_t elementSize = 0;       // 0 for tag components
+            uint32_t reserved = 0;
+            uint64_t indicesOffset = 0;     // uint32 entity indices
+            uint64_t valuesOffset = 0;      // Packed component values, aligned to SceneBlockAlignment
+        };
+
+        // Stable on-disk ids of the component columns; never renumber
+        // Ids stay below 64 so the loader can track seen columns in a uint64_t bitmask
+        enum class SceneColumn : uint32_t {
+            Active = 1,
+            Position,
+            Velocity,
+            Size,
+            Sprite,
+            Animation,
+            PlayerInput,
+            AABB,
+            Player,
+            CameraTarget
+        };
+
+        template<SceneColumn Id, typename T>
+        struct Column {
+            static_assert(std::is_trivially_copyable_v<T>, "Binary scene columns must be trivially copyable");
+            static_assert(alignof(T) <= SceneBlockAlignment, "Binary scene column is over-aligned");
+            static_assert(static_cast<uint32_t>(Id) < 64, "Binary scene column id must fit the loader's seen mask");
+
+            static constexpr SceneColumn id = Id;
+            static constexpr uint32_t elementSize = std::is_empty_v<T> ? 0 : static_cast<uint32_t>(sizeof(T));
+            using Type = T;
+        };
+
+        // The components stored in binary scenes (the same set the YAML format writes)
+        template<typename Func>
+        void forEachColumn(Func&& func) {
+            func(Column<SceneColumn::Active, ECS::Active>{});
+            func(Column<SceneColumn::Position, ECS::Position>{});
+            func(Column<SceneColumn::Velocity, ECS::Velocity>{});
+            func(Column<SceneColumn::Size, ECS::Size>{});
+            func(Column<SceneColumn::Sprite, ECS::Sprite>{});
+            func(Column<SceneColumn::Animation, ECS::Animation>{});
+            func(Column<SceneColumn::PlayerInput, ECS::PlayerInput>{});
+            func(Column<SceneColumn::AABB, ECS::AABB>{});
+            func(Column<SceneColumn::Player, ECS::Player>{});
+            func(Column<SceneColumn::CameraTarget, ECS::CameraTarget>{});
+        }
+
+        size_t alignUp(size_t value, size_t alignment) {
+            return (value + alignment - 1) & ~(alignment - 1);
+        }
+
+        uint64_t getSourceStamp(const std::string& filePath) {
+            std::error_code ec;
+            auto time = std::filesystem::last_write_time(filePath, ec);
+            if (ec) {
+                return 0;
+            }
+            return static_cast<uint64_t>(time.time_since_epoch().count());
+        }
+
+        /**
+         * Builds a binary scene in memory. Strings are collected into a local
+         * table so the file does not depend on this process's StringPool ids.
+         */
+        class SceneWriter {
+        public:
+            uint32_t addString(StringId id) {
+                if (id == NullStringId) {
+                    return 0;
+                }
+                auto [it, inserted] = m_stringIndex.try_emplace(id, static_cast<uint32_t>(m_strings.size()));
+                if (inserted) {
+                    m_strings.push_back(id);
+                }
+                return it->second;
+            }
+
+            template<typename ColumnType>
+            void addColumn(const entt::registry& registry, const entt::sparse_set& active) {
+                using T = typename ColumnType::Type;
+
+                Block block;
+                block.header.column = static_cast<uint32_t>(ColumnType::id);
+                block.header.elementSize = ColumnType::elementSize;
+
+                for (auto entity : registry.view<ECS::Active, T>()) {
+                    block.indices.push_back(static_cast<uint32_t>(active.index(entity)));
+
+                    if constexpr (!std::is_empty_v<T>) {
+                        T value = registry.get<T>(entity);
+                        if constexpr (std::is_same_v<T, ECS::Sprite>) {
+                            // Sheets are resolved by the scene after loading
+                            value.spriteSheet = nullptr;
+                            value.spriteName = addString(value.spriteName);
+                        }
+                        const auto* bytes = reinterpret_cast<const std::byte*>(&value);
+                        block.values.insert(block.values.end(), bytes, bytes + sizeof(T));
+                    }
+                }
+
+                block.header.count = static_cast<uint32_t>(block.indices.size());
+                if (block.header.count > 0) {
+                    m_blocks.push_back(std::move(block));
+                }
+            }
+
+            std::vector<std::byte> finish(uint32_t entityCount, uint32_t sceneName, uint32_t sceneType, uint64_t sourceStamp) {
+                SceneFileHeader header;
+                header.blockCount = static_cast<uint16_t>(m_blocks.size());
+                header.entityCount = entityCount;
+                header.stringCount = static_cast<uint32_t>(m_strings.size());
+                header.sourceStamp = sourceStamp;
+                header.sceneName = sceneName;
+                header.sceneType = sceneType;
+
+                // Layout: header, block headers, string table, then each block's indices and values
+                size_t offset = sizeof(SceneFileHeader);
+                header.blocksOffset = offset;
+                offset += m_blocks.size() * sizeof(ColumnBlockHeader);
+
+                header.stringTableOffset = offset;
+                uint32_t characters = 0;
+                std::vector<uint32_t> stringOffsets;
+                stringOffsets.reserve(m_strings.size() + 1);
+                for (StringId id : m_strings) {
+                    stringOffsets.push_back(characters);
+                    characters += static_cast<uint32_t>(StringPool::lookup(id).size());
+                }
+                stringOffsets.push_back(characters);
+                offset += stringOffsets.size() * sizeof(uint32_t) + characters;
+
+                for (auto& block : m_blocks) {
+                    offset = alignUp(offset, SceneBlockAlignment);
+                    block.header.indicesOffset = offset;
+                    offset += block.indices.size() * sizeof(uint32_t);
+                    offset = alignUp(offset, SceneBlockAlignment);
+                    block.header.valuesOffset = offset;
+                    offset += block.values.size();
+                }
+
+                std::vector<std::byte> out(offset);
+                auto put = [&out](size_t at, const void* data, size_t size) {
+                    if (size > 0) {
+                        std::memcpy(out.data() + at, data, size);
+                    }
+                };
+
+                put(0, &header, sizeof(header));
+                for (size_t i = 0; i < m_blocks.size(); ++i) {
+                    put(header.blocksOffset + i * sizeof(ColumnBlockHeader), &m_blocks[i].header, sizeof(ColumnBlockHeader));
+                }
+
+                size_t cursor = header.stringTableOffset;
+                put(cursor, stringOffsets.data(), stringOffsets.size() * sizeof(uint32_t));
+                cursor += stringOffsets.size() * sizeof(uint32_t);
+                for (StringId id : m_strings) {
+                    const std::string& str = StringPool::lookup(id);
+                    put(cursor, str.data(), str.size());
+                    cursor += str.size();
+                }
+
+                for (const auto& block : m_blocks) {
+                    put(block.header.indicesOffset, block.indices.data(), block.indices.size() * sizeof(uint32_t));
+                    put(block.header.valuesOffset, block.values.data(), block.values.size());
+                }
+                return out;
+            }
+
+        private:
+            struct Block {
+                ColumnBlockHeader header;
+                std::vector<uint32_t> indices;
+                std::vector<std::byte> values;
+            };
+
+            std::vector<Block> m_blocks;
+            std::vector<StringId> m_strings{NullStringId};     // Index 0 is the empty string
+            std::unordered_map<StringId, uint32_t> m_stringIndex;
+        };
+
+        bool writeSceneBinary(const entt::registry& registry, const std::string& sceneName, const std::string& sceneType,
+                              const std::string& filePath, uint64_t sourceStamp) {
+            const auto* active = registry.storage<ECS::Active>();
+
+            SceneWriter writer;
+            uint32_t nameIndex = writer.addString(StringPool::intern(sceneName));
+            uint32_t typeIndex = writer.addString(StringPool::intern(sceneType));
+            uint32_t entityCount = 0;
+
+            if (active) {
+                entityCount = static_cast<uint32_t>(active->size());
+                forEachColumn([&](auto column) {
+                    writer.addColumn<decltype(column)>(registry, *active);
+                });
+            }
+
+            std::vector<std::byte> data = writer.finish(entityCount, nameIndex, typeIndex, sourceStamp);
+
+            std::filesystem::path path(filePath);
+            if (path.has_parent_path()) {
+                std::filesystem::create_directories(path.parent_path());
+            }
+
+            std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+            if (!file.is_open()) {
+                LOG_ERROR("Failed to open file for writing: {}", filePath);
+                return false;
+            }
+            file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+            if (!file) {
+                LOG_ERROR("Failed to write binary scene: {}", filePath);
+                return false;
+            }
+            return true;
+        }
+
+        bool inFile(const MappedFile& file, uint64_t offset, uint64_t size) {
+            return offset <= file.size() && size <= file.size() - offset;
+        }
+
+        template<typename T>
+        const T* at(const MappedFile& file, uint64_t offset) {
+            return reinterpret_cast<const T*>(file.data() + offset);
+        }
+
+        // Component fields as a YAML map (tags as `true`), driven by the reflection tables
+        void emitFields(std::span<const ECS::FieldInfo> fields, const void* component, YAML::Emitter& out) {
+            if (fields.empty()) {
+                out << true;
+                return;
+            }
+
+            out << YAML::BeginMap;
+            for (const auto& field : fields) {
+                out << YAML::Key << field.name << YAML::Value;
+                switch (field.type) {
+                    case ECS::FieldType::Float:
+                        out << ECS::readField<float>(component, field);
+                        break;
+                    case ECS::FieldType::Int:
+                        out << ECS::readField<int>(component, field);
+                        break;
+                    case ECS::FieldType::UInt32:
+                    case ECS::FieldType::Enum:
+                        out << ECS::readField<uint32_t>(component, field);
+                        break;
+                    case ECS::FieldType::Bool:
+                        out << ECS::readField<bool>(component, field);
+                        break;
+                    case ECS::FieldType::String:
+                        out << StringPool::lookup(ECS::readField<StringId>(component, field));
+                        break;
+                }
+            }
+            out << YAML::EndMap;
+        }
+
+        void readFields(std::span<const ECS::FieldInfo> fields, void* component, const YAML::Node& node) {
+            if (!node.IsMap()) {
+                return;
+            }
+
+            for (const auto& field : fields) {
+                const YAML::Node value = node[field.name];
+                if (!value) {
+                    continue;
+                }
+
+                switch (field.type) {
+                    case ECS::FieldType::Float:
+                        ECS::writeField(component, field, value.as<float>(ECS::readField<float>(component, field)));
+                        break;
+                    case ECS::FieldType::Int:
+                        ECS::writeField(component, field, value.as<int>(ECS::readField<int>(component, field)));
+                        break;
+                    case ECS::FieldType::UInt32:
+                    case ECS::FieldType::Enum:
+                        ECS::writeField(component, field, value.as<uint32_t>(ECS::readField<uint32_t>(component, field)));
+                        break;
+                    case ECS::FieldType::Bool:
+                        ECS::writeField(component, field, value.as<bool>(ECS::readField<bool>(component, field)));
+                        break;
+                    case ECS::FieldType::String:
+                        ECS::writeField(component, field, StringPool::intern(value.as<std::string>("")));
+                        break;
+                }
+            }
+        }
+
+        using ComponentEmitter = void (*)(const entt::registry&, entt::entity, YAML::Emitter&);
+
+        template<typename Type>
+        void emitComponent(const entt::registry& registry, entt::entity entity, YAML::Emitter& out) {
+            out << YAML::Key << ECS::ComponentInfo<Type>::name << YAML::Value;
+            if constexpr (std::is_empty_v<Type>) {
+                emitFields({}, nullptr, out);
+            } else {
+                emitFields(ECS::ComponentInfo<Type>::fields, &registry.storage<Type>()->get(entity), out);
+            }
+        }
+    }
+
     bool SceneSerializer::saveScene(Scene& scene, const std::string& filePath) {
         try {
             YAML::Emitter out;
@@ -79,6 +410,18 @@ namespace Runa {
     }
 
     bool SceneSerializer::loadScene(Scene& scene, const std::string& filePath) {
+        if (std::filesystem::path(filePath).extension() == SceneBinaryExtension) {
+            return loadSceneBinary(scene, filePath);
+        }
+
+        // Use the binary cache when it was built from this revision of the YAML file
+        std::string cachePath = getBinaryCachePath(filePath);
+        uint64_t stamp = getSourceStamp(filePath);
+        if (stamp != 0 && loadBinary(scene, cachePath, stamp)) {
+            LOG_INFO("Scene loaded from binary cache: {}", cachePath);
+            return true;
+        }
+
         try {
             std::ifstream file(filePath);
             if (!file.is_open()) {
@@ -102,7 +445,7 @@ namespace Runa {
 
             // Load entities
             if (root["entities"] && scene.getRegistry()) {
-                deserializeRegistry(*scene.getRegistry(), root["entities"], scene);
+                deserializeRegistry(*scene.getRegistry(), root["entities"]);
             }
 
             // Load scene-specific data
@@ -118,6 +461,11 @@ namespace Runa {
             }
 
             LOG_INFO("Scene loaded successfully from: {}", filePath);
+
+            // Build the cache for the next load; failure only costs the next load its speedup
+            if (stamp != 0) {
+                writeBinaryFromYaml(root, cachePath, stamp);
+            }
             return true;
 
         } catch (const YAML::Exception& e) {
@@ -130,116 +478,48 @@ namespace Runa {
     }
 
     void SceneSerializer::serializeRegistry(ECS::EntityRegistry& registry, YAML::Emitter& out) {
-        auto& reg = registry.getRegistry();
+        const entt::registry& reg = registry.getRegistry();
 
         out << YAML::BeginSeq;
 
-        // Serialize all entities with their components
-        auto view = reg.view<ECS::Active>();
-        for (auto entity : view) {
+        const auto* activeStorage = reg.storage<ECS::Active>();
+        if (!activeStorage) {
+            out << YAML::EndSeq;
+            return;
+        }
+        const entt::sparse_set& active = *activeStorage;
+
+        // Gather which serialized components each entity has, one storage at a time,
+        // so the per-entity pass below never probes for a type
+        std::array<ComponentEmitter, ECS::SerializedComponents::size> emitters{};
+        std::vector<uint32_t> presence(active.size(), 0);
+
+        ECS::forEachReflected<ECS::SerializedComponents>([&]<typename Type>(uint32_t index) {
+            emitters[index] = &emitComponent<Type>;
+            if (const auto* storage = reg.storage<Type>()) {
+                for (auto entity : static_cast<const entt::sparse_set&>(*storage)) {
+                    if (active.contains(entity)) {
+                        presence[active.index(entity)] |= 1u << index;
+                    }
+                }
+            }
+        });
+
+        for (auto entity : active) {
             out << YAML::BeginMap;
 
             // Entity ID (for reference, though we'll regenerate on load)
             out << YAML::Key << "id" << YAML::Value << static_cast<uint32_t>(entt::to_integral(entity));
 
-            // Serialize components
-            bool hasComponents = false;
-            if (reg.all_of<ECS::Position>(entity) || reg.all_of<ECS::Velocity>(entity) ||
-                reg.all_of<ECS::Size>(entity) || reg.all_of<ECS::Sprite>(entity) ||
-                reg.all_of<ECS::Animation>(entity) || reg.all_of<ECS::PlayerInput>(entity) ||
-                reg.all_of<ECS::AABB>(entity) || reg.all_of<ECS::Player>(entity) ||
-                reg.all_of<ECS::CameraTarget>(entity)) {
+            uint32_t mask = presence[active.index(entity)];
+            if (mask != 0) {
                 out << YAML::Key << "components" << YAML::Value;
                 out << YAML::BeginMap;
-                hasComponents = true;
-            }
-
-            if (reg.all_of<ECS::Position>(entity)) {
-                const auto& pos = reg.get<ECS::Position>(entity);
-                out << YAML::Key << "Position" << YAML::Value;
-                out << YAML::BeginMap;
-                out << YAML::Key << "x" << YAML::Value << pos.x;
-                out << YAML::Key << "y" << YAML::Value << pos.y;
-                out << YAML::EndMap;
-            }
-
-            if (reg.all_of<ECS::Velocity>(entity)) {
-                const auto& vel = reg.get<ECS::Velocity>(entity);
-                out << YAML::Key << "Velocity" << YAML::Value;
-                out << YAML::BeginMap;
-                out << YAML::Key << "x" << YAML::Value << vel.x;
-                out << YAML::Key << "y" << YAML::Value << vel.y;
-                out << YAML::EndMap;
-            }
-
-            if (reg.all_of<ECS::Size>(entity)) {
-                const auto& size = reg.get<ECS::Size>(entity);
-                out << YAML::Key << "Size" << YAML::Value;
-                out << YAML::BeginMap;
-                out << YAML::Key << "width" << YAML::Value << size.width;
-                out << YAML::Key << "height" << YAML::Value << size.height;
-                out << YAML::EndMap;
-            }
-
-            if (reg.all_of<ECS::Sprite>(entity)) {
-                const auto& sprite = reg.get<ECS::Sprite>(entity);
-                out << YAML::Key << "Sprite" << YAML::Value;
-                out << YAML::BeginMap;
-                // Store sprite sheet path/name instead of pointer
-                out << YAML::Key << "spriteName" << YAML::Value << sprite.spriteName;
-                out << YAML::Key << "tintR" << YAML::Value << sprite.tintR;
-                out << YAML::Key << "tintG" << YAML::Value << sprite.tintG;
-                out << YAML::Key << "tintB" << YAML::Value << sprite.tintB;
-                out << YAML::Key << "tintA" << YAML::Value << sprite.tintA;
-                out << YAML::Key << "flipX" << YAML::Value << sprite.flipX;
-                out << YAML::Key << "flipY" << YAML::Value << sprite.flipY;
-                out << YAML::EndMap;
-            }
-
-            if (reg.all_of<ECS::Animation>(entity)) {
-                const auto& anim = reg.get<ECS::Animation>(entity);
-                out << YAML::Key << "Animation" << YAML::Value;
-                out << YAML::BeginMap;
-                out << YAML::Key << "currentFrame" << YAML::Value << anim.currentFrame;
-                out << YAML::Key << "animationTime" << YAML::Value << anim.animationTime;
-                out << YAML::Key << "frameRate" << YAML::Value << anim.frameRate;
-                out << YAML::Key << "loop" << YAML::Value << anim.loop;
-                out << YAML::EndMap;
-            }
-
-            if (reg.all_of<ECS::PlayerInput>(entity)) {
-                const auto& input = reg.get<ECS::PlayerInput>(entity);
-                out << YAML::Key << "PlayerInput" << YAML::Value;
-                out << YAML::BeginMap;
-                out << YAML::Key << "speed" << YAML::Value << input.speed;
-                out << YAML::EndMap;
-            }
-
-            if (reg.all_of<ECS::AABB>(entity)) {
-                const auto& aabb = reg.get<ECS::AABB>(entity);
-                out << YAML::Key << "AABB" << YAML::Value;
-                out << YAML::BeginMap;
-                out << YAML::Key << "offsetX" << YAML::Value << aabb.offsetX;
-                out << YAML::Key << "offsetY" << YAML::Value << aabb.offsetY;
-                out << YAML::Key << "width" << YAML::Value << aabb.width;
-                out << YAML::Key << "height" << YAML::Value << aabb.height;
-                out << YAML::EndMap;
-            }
-
-            // Tags
-            if (reg.all_of<ECS::Player>(entity)) {
-                out << YAML::Key << "Player" << YAML::Value << true;
-            }
-
-            if (reg.all_of<ECS::CameraTarget>(entity)) {
-                const auto& target = reg.get<ECS::CameraTarget>(entity);
-                out << YAML::Key << "CameraTarget" << YAML::Value;
-                out << YAML::BeginMap;
-                out << YAML::Key << "smoothing" << YAML::Value << target.smoothing;
-                out << YAML::EndMap;
-            }
-
-            if (hasComponents) {
+                for (uint32_t index = 0; index < emitters.size(); ++index) {
+                    if (mask & (1u << index)) {
+                        emitters[index](reg, entity, out);
+                    }
+                }
                 out << YAML::EndMap; // components
             }
 
@@ -249,7 +529,7 @@ namespace Runa {
         out << YAML::EndSeq;
     }
 
-    void SceneSerializer::deserializeRegistry(ECS::EntityRegistry& registry, const YAML::Node& node, Scene& scene) {
+    void SceneSerializer::deserializeRegistry(ECS::EntityRegistry& registry, const YAML::Node& node) {
         if (!node.IsSequence()) {
             LOG_ERROR("Entities node is not a sequence");
             return;
@@ -269,89 +549,289 @@ namespace Runa {
             if (!entityNode["components"]) continue;
             const auto& components = entityNode["components"];
 
-            // Position
-            if (components["Position"]) {
-                const auto& pos = components["Position"];
-                reg.emplace<ECS::Position>(entity,
-                    pos["x"].as<float>(0.0f),
-                    pos["y"].as<float>(0.0f));
+            ECS::forEachReflected<ECS::SerializedComponents>([&]<typename Type>(uint32_t) {
+                using Info = ECS::ComponentInfo<Type>;
+                const YAML::Node componentNode = components[Info::name];
+                if (!componentNode) {
+                    return;
+                }
+
+                if constexpr (std::is_empty_v<Type>) {
+                    reg.emplace<Type>(entity);
+                } else {
+                    // Missing fields keep the component's defaults. Sprite::spriteSheet is not
+                    // reflected; the scene matches spriteName to a sheet after loading.
+                    Type component{};
+                    readFields(Info::fields, &component, componentNode);
+                    reg.emplace<Type>(entity, component);
+                }
+            });
+        }
+
+        LOG_INFO("Deserialized {} entities", node.size());
+    }
+
+    void SceneSerializer::serializeComponent(const std::string& componentName, const void* component, YAML::Emitter& out) {
+        const auto* descriptor = ECS::findComponentDescriptor(componentName);
+        if (!descriptor) {
+            LOG_WARN("serializeComponent: Unknown component '{}'", componentName);
+            return;
+        }
+        emitFields(descriptor->fields, component, out);
+    }
+
+    void SceneSerializer::deserializeComponent(const std::string& componentName, void* component, const YAML::Node& node) {
+        const auto* descriptor = ECS::findComponentDescriptor(componentName);
+        if (!descriptor) {
+            LOG_WARN("deserializeComponent: Unknown component '{}'", componentName);
+            return;
+        }
+        readFields(descriptor->fields, component, node);
+    }
+
+    bool SceneSerializer::saveSceneBinary(Scene& scene, const std::string& filePath) {
+        auto* registry = scene.getRegistry();
+        if (!registry) {
+            LOG_ERROR("Scene has no registry to save: {}", scene.getName());
+            return false;
+        }
+
+        try {
+            if (!writeSceneBinary(registry->getRegistry(), scene.getName(),
+                                  scene.getType().empty() ? "Scene" : scene.getType(), filePath, 0)) {
+                return false;
             }
+            LOG_INFO("Scene saved successfully to: {}", filePath);
+            return true;
 
-            // Velocity
-            if (components["Velocity"]) {
-                const auto& vel = components["Velocity"];
-                reg.emplace<ECS::Velocity>(entity,
-                    vel["x"].as<float>(0.0f),
-                    vel["y"].as<float>(0.0f));
+        } catch (const std::exception& e) {
+            LOG_ERROR("Exception while saving binary scene: {}", e.what());
+            return false;
+        }
+    }
+
+    bool SceneSerializer::loadSceneBinary(Scene& scene, const std::string& filePath) {
+        if (!loadBinary(scene, filePath, 0)) {
+            LOG_ERROR("Failed to load binary scene: {}", filePath);
+            return false;
+        }
+
+        LOG_INFO("Scene loaded successfully from: {}", filePath);
+        return true;
+    }
+
+    bool SceneSerializer::convertToBinary(const std::string& yamlPath, const std::string& binaryPath) {
+        try {
+            YAML::Node root = YAML::LoadFile(yamlPath);
+            if (!root.IsMap()) {
+                LOG_ERROR("Invalid scene file format: {}", yamlPath);
+                return false;
+            }
+
+            if (!writeBinaryFromYaml(root, binaryPath, getSourceStamp(yamlPath))) {
+                return false;
             }
+            LOG_INFO("Converted scene {} to {}", yamlPath, binaryPath);
+            return true;
+
+        } catch (const YAML::Exception& e) {
+            LOG_ERROR("YAML error while converting scene: {}", e.what());
+            return false;
+        }
+    }
+
+    std::string SceneSerializer::getBinaryCachePath(const std::string& yamlPath) {
+        return std::filesystem::path(yamlPath).replace_extension(SceneBinaryExtension).string();
+    }
 
-            // Size
-            if (components["Size"]) {
-                const auto& size = components["Size"];
-                reg.emplace<ECS::Size>(entity,
-                    size["width"].as<float>(16.0f),
-                    size["height"].as<float>(16.0f));
+    bool SceneSerializer::writeBinaryFromYaml(const YAML::Node& root, const std::string& binaryPath, uint64_t sourceStamp) {
+        try {
+            std::string sceneName = "Scene";
+            std::string sceneType = "Scene";
+            if (const auto& sceneNode = root["scene"]) {
+                sceneName = sceneNode["name"].as<std::string>(sceneName);
+                sceneType = sceneNode["type"].as<std::string>(sceneType);
             }
 
-            // Sprite
-            if (components["Sprite"]) {
-                const auto& spriteNode = components["Sprite"];
-                ECS::Sprite sprite;
-                sprite.spriteName = spriteNode["spriteName"].as<std::string>("");
-                sprite.tintR = spriteNode["tintR"].as<float>(1.0f);
-                sprite.tintG = spriteNode["tintG"].as<float>(1.0f);
-                sprite.tintB = spriteNode["tintB"].as<float>(1.0f);
-                sprite.tintA = spriteNode["tintA"].as<float>(1.0f);
-                sprite.flipX = spriteNode["flipX"].as<bool>(false);
-                sprite.flipY = spriteNode["flipY"].as<bool>(false);
-                // Note: spriteSheet pointer will need to be set by the scene after loading
-                // The scene should match spriteName to the appropriate sprite sheet
-                reg.emplace<ECS::Sprite>(entity, sprite);
+            // Build the entities in a scratch registry so the file holds exactly the YAML's contents
+            ECS::EntityRegistry scratch;
+            if (root["entities"]) {
+                deserializeRegistry(scratch, root["entities"]);
             }
 
-            // Animation
-            if (components["Animation"]) {
-                const auto& animNode = components["Animation"];
-                ECS::Animation anim;
-                anim.currentFrame = animNode["currentFrame"].as<int>(0);
-                anim.animationTime = animNode["animationTime"].as<float>(0.0f);
-                anim.frameRate = animNode["frameRate"].as<float>(10.0f);
-                anim.loop = animNode["loop"].as<bool>(true);
-                reg.emplace<ECS::Animation>(entity, anim);
+            return writeSceneBinary(scratch.getRegistry(), sceneName, sceneType, binaryPath, sourceStamp);
+
+        } catch (const std::exception& e) {
+            LOG_WARN("Could not write binary scene {}: {}", binaryPath, e.what());
+            return false;
+        }
+    }
+
+    bool SceneSerializer::loadBinary(Scene& scene, const std::string& filePath, uint64_t requiredStamp) {
+        auto* entityRegistry = scene.getRegistry();
+        if (!entityRegistry) {
+            return false;
+        }
+
+        MappedFile file;
+        if (!file.open(filePath)) {
+            LOG_DEBUG("Binary scene not available: {}", filePath);
+            return false;
+        }
+
+        // Validate everything before touching the registry
+        if (file.size() < sizeof(SceneFileHeader)) {
+            LOG_WARN("Binary scene is truncated: {}", filePath);
+            return false;
+        }
+
+        const auto& header = *at<SceneFileHeader>(file, 0);
+        if (header.magic != SceneMagic || header.version != SceneFormatVersion) {
+            LOG_WARN("Binary scene {} has an unsupported format (version {}, expected {})",
+                     filePath, header.version, SceneFormatVersion);
+            return false;
+        }
+        if (requiredStamp != 0 && header.sourceStamp != requiredStamp) {
+            LOG_DEBUG("Binary scene cache is stale: {}", filePath);
+            return false;
+        }
+
+        uint64_t stringOffsetsSize = (static_cast<uint64_t>(header.stringCount) + 1) * sizeof(uint32_t);
+        if (header.stringCount == 0 ||
+            !inFile(file, header.blocksOffset, static_cast<uint64_t>(header.blockCount) * sizeof(ColumnBlockHeader)) ||
+            !inFile(file, header.stringTableOffset, stringOffsetsSize) ||
+            header.blocksOffset % alignof(ColumnBlockHeader) != 0 ||
+            header.stringTableOffset % alignof(uint32_t) != 0) {
+            LOG_WARN("Binary scene is corrupt: {}", filePath);
+            return false;
+        }
+
+        const uint32_t* stringOffsets = at<uint32_t>(file, header.stringTableOffset);
+        uint64_t charactersOffset = header.stringTableOffset + stringOffsetsSize;
+        if (!inFile(file, charactersOffset, stringOffsets[header.stringCount])) {
+            LOG_WARN("Binary scene string table is corrupt: {}", filePath);
+            return false;
+        }
+        for (uint32_t i = 0; i < header.stringCount; ++i) {
+            if (stringOffsets[i] > stringOffsets[i + 1]) {
+                LOG_WARN("Binary scene string table is corrupt: {}", filePath);
+                return false;
             }
+        }
 
-            // PlayerInput
-            if (components["PlayerInput"]) {
-                const auto& inputNode = components["PlayerInput"];
-                reg.emplace<ECS::PlayerInput>(entity,
-                    inputNode["speed"].as<float>(100.0f));
+        const auto* blocks = at<ColumnBlockHeader>(file, header.blocksOffset);
+        uint64_t seenColumns = 0;
+        uint64_t totalCount = 0;
+        for (uint32_t b = 0; b < header.blockCount; ++b) {
+            const auto& block = blocks[b];
+            bool known = false;
+            bool valid = true;
+
+            forEachColumn([&](auto column) {
+                using ColumnType = decltype(column);
+                if (block.column != static_cast<uint32_t>(ColumnType::id)) {
+                    return;
+                }
+                known = true;
+                valid = block.elementSize == ColumnType::elementSize &&
+                        inFile(file, block.indicesOffset, static_cast<uint64_t>(block.count) * sizeof(uint32_t)) &&
+                        inFile(file, block.valuesOffset, static_cast<uint64_t>(block.count) * block.elementSize) &&
+                        block.indicesOffset % alignof(uint32_t) == 0 &&
+                        block.valuesOffset % SceneBlockAlignment == 0;
+            });
+
+            if (!known || !valid) {
+                LOG_WARN("Binary scene {} has an invalid column block (column {})", filePath, block.column);
+                return false;
             }
 
-            // AABB
-            if (components["AABB"]) {
-                const auto& aabbNode = components["AABB"];
-                ECS::AABB aabb;
-                aabb.offsetX = aabbNode["offsetX"].as<float>(0.0f);
-                aabb.offsetY = aabbNode["offsetY"].as<float>(0.0f);
-                aabb.width = aabbNode["width"].as<float>(16.0f);
-                aabb.height = aabbNode["height"].as<float>(16.0f);
-                reg.emplace<ECS::AABB>(entity, aabb);
+            // A second block for the same column would insert into entities that already have it
+            const uint64_t columnBit = uint64_t{1} << block.column;
+            if (seenColumns & columnBit) {
+                LOG_WARN("Binary scene {} has more than one block for column {}", filePath, block.column);
+                return false;
             }
+            seenColumns |= columnBit;
+            totalCount += block.count;
+        }
+
+        // Every written entity is in the Active column, so a valid file never has more
+        // entities than block entries; checked before entityCount sizes any allocation
+        if (header.entityCount > totalCount || header.entityCount > MaxSceneEntities) {
+            LOG_WARN("Binary scene {} claims {} entities but has {} component entries",
+                     filePath, header.entityCount, totalCount);
+            return false;
+        }
 
-            // Tags
-            if (components["Player"]) {
-                reg.emplace<ECS::Player>(entity);
+        std::vector<bool> present(header.entityCount);
+        for (uint32_t b = 0; b < header.blockCount; ++b) {
+            const auto& block = blocks[b];
+            const uint32_t* indices = at<uint32_t>(file, block.indicesOffset);
+            std::fill(present.begin(), present.end(), false);
+            for (uint32_t i = 0; i < block.count; ++i) {
+                if (indices[i] >= header.entityCount) {
+                    LOG_WARN("Binary scene {} references entity {} of {}", filePath, indices[i], header.entityCount);
+                    return false;
+                }
+                if (present[indices[i]]) {
+                    LOG_WARN("Binary scene {} lists entity {} twice in column {}", filePath, indices[i], block.column);
+                    return false;
+                }
+                present[indices[i]] = true;
             }
+        }
+
+        // File-local string indices -> StringPool ids
+        std::vector<StringId> strings(header.stringCount, NullStringId);
+        const char* characters = reinterpret_cast<const char*>(file.data() + charactersOffset);
+        for (uint32_t i = 1; i < header.stringCount; ++i) {
+            strings[i] = StringPool::intern(std::string_view(characters + stringOffsets[i],
+                                                             stringOffsets[i + 1] - stringOffsets[i]));
+        }
+
+        auto& registry = entityRegistry->getRegistry();
+        std::vector<entt::entity> entities(header.entityCount);
+        registry.create(entities.begin(), entities.end());
+
+        // Bulk-insert each column straight from the mapping
+        std::vector<entt::entity> targets;
+        for (uint32_t b = 0; b < header.blockCount; ++b) {
+            const auto& block = blocks[b];
+            const uint32_t* indices = at<uint32_t>(file, block.indicesOffset);
 
-            // CameraTarget
-            if (components["CameraTarget"]) {
-                const auto& targetNode = components["CameraTarget"];
-                reg.emplace<ECS::CameraTarget>(entity,
-                    targetNode["smoothing"].as<float>(0.15f));
+            targets.resize(block.count);
+            for (uint32_t i = 0; i < block.count; ++i) {
+                targets[i] = entities[indices[i]];
             }
+
+            forEachColumn([&](auto column) {
+                using ColumnType = decltype(column);
+                using T = typename ColumnType::Type;
+                if (block.column != static_cast<uint32_t>(ColumnType::id)) {
+                    return;
+                }
+
+                auto& storage = registry.storage<T>();
+                if constexpr (std::is_empty_v<T>) {
+                    storage.insert(targets.begin(), targets.end());
+                } else if constexpr (std::is_same_v<T, ECS::Sprite>) {
+                    // Sprite names need translating, so sprites take one copy
+                    const T* values = at<T>(file, block.valuesOffset);
+                    std::vector<T> sprites(values, values + block.count);
+                    for (auto& sprite : sprites) {
+                        sprite.spriteName = sprite.spriteName < strings.size() ? strings[sprite.spriteName] : NullStringId;
+                        sprite.spriteSheet = nullptr;
+                    }
+                    storage.insert(targets.begin(), targets.end(), sprites.begin());
+                } else {
+                    const T* values = at<T>(file, block.valuesOffset);
+                    storage.insert(targets.begin(), targets.end(), values);
+                }
+            });
         }
 
-        LOG_INFO("Deserialized {} entities", node.size());
+        LOG_INFO("Deserialized {} entities", header.entityCount);
+        return true;
     }
 
 }
@@ -3,13 +3,15 @@
 /**
  * SceneSerializer.h
  * Serializes and deserializes scene state to/from YAML files.
- * Uses YAML format for human-readability and tool compatibility.
+ * Uses YAML format for human-readability and tool compatibility, with a
+ * compact binary format (.rscn) for fast loading.
  */
 
 #ifndef RUNA_CORE_SCENESERIALIZER_H
 #define RUNA_CORE_SCENESERIALIZER_H
 
 #include "../RunaAPI.h"
+#include <cstdint>
 #include <string>
 #include <memory>
 
@@ -37,6 +39,13 @@ namespace Runa {
      * - Compatible with many tools (editors, validators, etc.)
      * - Supports ECS entities with all components
      * - Supports scene-specific metadata
+     *
+     * Binary format (.rscn):
+     * - Header with schema version, string table and one column block per component type
+     * - Each block holds the entity indices and the packed component values,
+     *   which are bulk-inserted into the registry straight from a memory-mapped file
+     * - Loading a .yaml scene uses a sibling .rscn cache when it was built from
+     *   the same file revision, and writes that cache otherwise
      */
     class RUNA_API SceneSerializer {
     public:
@@ -59,14 +68,43 @@ namespace Runa {
          */
         static bool loadScene(Scene& scene, const std::string& filePath);
 
+        /**
+         * Save the scene's active entities to a binary scene file.
+         * @return true if successful, false otherwise
+         */
+        static bool saveSceneBinary(Scene& scene, const std::string& filePath);
+
+        /**
+         * Load entities from a binary scene file. The file is validated in full
+         * before any entity is created.
+         * @return true if successful, false otherwise
+         */
+        static bool loadSceneBinary(Scene& scene, const std::string& filePath);
+
+        /**
+         * Convert a YAML scene to the binary format without a live scene (offline conversion).
+         * @return true if successful, false otherwise
+         */
+        static bool convertToBinary(const std::string& yamlPath, const std::string& binaryPath);
+
+        // Path of the binary cache used for a YAML scene file (same name, .rscn extension)
+        static std::string getBinaryCachePath(const std::string& yamlPath);
+
+        /**
+         * Generic component serialization by reflected component name (see ECS/Reflection.h).
+         * Fields missing from the node keep their current values.
+         */
+        static void serializeComponent(const std::string& componentName, const void* component, YAML::Emitter& out);
+        static void deserializeComponent(const std::string& componentName, void* component, const YAML::Node& node);
+
     private:
         // Helper methods for serialization
         static void serializeRegistry(ECS::EntityRegistry& registry, YAML::Emitter& out);
-        static void deserializeRegistry(ECS::EntityRegistry& registry, const YAML::Node& node, Scene& scene);
-        
-        // Component serialization helpers (unused for now, but kept for future extensibility)
-        static void serializeComponent(const std::string& componentName, const void* component, YAML::Emitter& out);
-        static void deserializeComponent(const std::string& componentName, void* component, const YAML::Node& node);
+        static void deserializeRegistry(ECS::EntityRegistry& registry, const YAML::Node& node);
+
+        // Binary helpers; requiredStamp != 0 rejects files not built from that source revision
+        static bool loadBinary(Scene& scene, const std::string& filePath, uint64_t requiredStamp);
+        static bool writeBinaryFromYaml(const YAML::Node& root, const std::string& binaryPath, uint64_t sourceStamp);
     };
 
 }
@@ -0,0 +1,88 @@
+// File: src/Core/StringPool.cpp
+
+/**
+ * StringPool.cpp
+ * Implementation of the global string interner.
+ */
+
+#include "../runapch.h"
+#include "StringPool.h"
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+
+namespace Runa {
+
+    namespace {
+
+        struct PoolData {
+            std::shared_mutex mutex;
+            // deque keeps element addresses stable, so the map can key on views into it
+            std::deque<std::string> strings;
+            std::unordered_map<std::string_view, StringId> ids;
+
+            PoolData() {
+                strings.emplace_back();
+            }
+        };
+
+        PoolData& getPool() {
+            static PoolData pool;
+            return pool;
+        }
+
+    }
+
+    StringId StringPool::intern(std::string_view str) {
+        if (str.empty()) {
+            return NullStringId;
+        }
+
+        auto& pool = getPool();
+        {
+            std::shared_lock lock(pool.mutex);
+            auto it = pool.ids.find(str);
+            if (it != pool.ids.end()) {
+                return it->second;
+            }
+        }
+
+        std::unique_lock lock(pool.mutex);
+        auto it = pool.ids.find(str);
+        if (it != pool.ids.end()) {
+            return it->second;
+        }
+
+        StringId id = static_cast<StringId>(pool.strings.size());
+        const std::string& stored = pool.strings.emplace_back(str);
+        pool.ids.emplace(std::string_view(stored), id);
+        return id;
+    }
+
+    StringId StringPool::find(std::string_view str) {
+        if (str.empty()) {
+            return NullStringId;
+        }
+
+        auto& pool = getPool();
+        std::shared_lock lock(pool.mutex);
+        auto it = pool.ids.find(str);
+        return it != pool.ids.end() ? it->second : NullStringId;
+    }
+
+    const std::string& StringPool::lookup(StringId id) {
+        auto& pool = getPool();
+        std::shared_lock lock(pool.mutex);
+        if (id >= pool.strings.size()) {
+            return pool.strings[NullStringId];
+        }
+        return pool.strings[id];
+    }
+
+    size_t StringPool::size() {
+        auto& pool = getPool();
+        std::shared_lock lock(pool.mutex);
+        return pool.strings.size() - 1;
+    }
+
+}
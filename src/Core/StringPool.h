@@ -0,0 +1,55 @@
+// File: src/Core/StringPool.h
+
+/**
+ * StringPool.h
+ * Global string interning. Maps strings to small integer ids so hot code can
+ * compare and hash ids instead of std::string.
+ */
+
+#ifndef RUNA_CORE_STRINGPOOL_H
+#define RUNA_CORE_STRINGPOOL_H
+
+#include "../RunaAPI.h"
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace Runa {
+
+    using StringId = uint32_t;
+
+    // Id 0 is reserved for the empty string / "no string"
+    constexpr StringId NullStringId = 0;
+
+    /**
+     * StringPool - Process-wide interner.
+     * Ids are stable for the lifetime of the process and strings are never freed.
+     * All functions are thread-safe.
+     */
+    class RUNA_API StringPool {
+    public:
+        /**
+         * Intern a string, creating a new id if it hasn't been seen before.
+         * @param str The string to intern
+         * @return The id for the string (NullStringId for an empty string)
+         */
+        static StringId intern(std::string_view str);
+
+        /**
+         * Look up an already interned string without creating it.
+         * @return The id, or NullStringId if the string was never interned
+         */
+        static StringId find(std::string_view str);
+
+        /**
+         * Get the string for an id.
+         * @return The interned string, or an empty string for unknown ids
+         */
+        static const std::string& lookup(StringId id);
+
+        static size_t size();
+    };
+
+}
+
+#endif // RUNA_CORE_STRINGPOOL_H
@@ -0,0 +1,94 @@
+// File: src/ECS/Archetypes.h
+
+/**
+ * Archetypes.h
+ * Compile-time archetype dispatch for systems with optional components.
+ * A system declares its required components, its optional components and the
+ * list of optional-component combinations it handles; each combination gets
+ * its own exact view (missing optionals are excluded) and its own
+ * instantiation of the loop body, so the hot loop never calls try_get.
+ */
+
+#ifndef RUNA_ECS_ARCHETYPES_H
+#define RUNA_ECS_ARCHETYPES_H
+
+#include <entt/entt.hpp>
+#include <array>
+#include <cstdint>
+
+namespace Runa::ECS {
+
+    // The optional components present in one archetype
+    template<typename... Components>
+    using Archetype = entt::type_list<Components...>;
+
+    template<typename ArchetypeList, typename Component>
+    inline constexpr bool archetypeHas = entt::type_list_contains_v<ArchetypeList, Component>;
+
+    namespace detail {
+        // Bit i is set when the archetype has the i-th optional component.
+        // Fails to compile if the archetype names a component that is not optional.
+        template<typename Optional, typename ArchetypeList>
+        struct ArchetypeMask;
+
+        template<typename Optional, typename... Has>
+        struct ArchetypeMask<Optional, entt::type_list<Has...>> {
+            static constexpr uint32_t value = (0u | ... | (1u << entt::type_list_index_v<Has, Optional>));
+        };
+
+        template<typename Optional, typename... Archetypes>
+        constexpr bool coversAllCombinations(entt::type_list<Archetypes...>) {
+            constexpr size_t combinations = size_t{1} << Optional::size;
+            if (sizeof...(Archetypes) != combinations) {
+                return false;
+            }
+
+            std::array<bool, combinations> seen{};
+            for (uint32_t mask : {ArchetypeMask<Optional, Archetypes>::value...}) {
+                if (seen[mask]) {
+                    return false;
+                }
+                seen[mask] = true;
+            }
+            return true;
+        }
+
+        template<typename... Included, typename... Excluded>
+        auto makeView(entt::registry& registry, entt::type_list<Included...>, entt::type_list<Excluded...>) {
+            return registry.view<Included...>(entt::exclude<Excluded...>);
+        }
+    }
+
+    /**
+     * SystemArchetypes - Declared archetype list for one system.
+     * @tparam Required   entt::type_list of components every entity must have
+     * @tparam Optional   entt::type_list of components the system reads when present
+     * @tparam Archetypes entt::type_list of Archetype<...>, in iteration order; must
+     *                    list every combination of Optional exactly once
+     */
+    template<typename Required, typename Optional, typename Archetypes>
+    struct SystemArchetypes {
+        static_assert(Optional::size < 8, "Too many optional components for archetype dispatch");
+        static_assert(detail::coversAllCombinations<Optional>(Archetypes{}),
+                      "Archetype list must cover every optional-component combination exactly once");
+
+        /**
+         * Invoke func(view, Archetype<Has...>{}) once per archetype, in declaration order.
+         * The view includes Required + Has and excludes the remaining optionals.
+         */
+        template<typename Func>
+        static void each(entt::registry& registry, Func&& func) {
+            eachArchetype(registry, func, Archetypes{});
+        }
+
+    private:
+        template<typename Func, typename... Lists>
+        static void eachArchetype(entt::registry& registry, Func& func, entt::type_list<Lists...>) {
+            (func(detail::makeView(registry, entt::type_list_cat_t<Required, Lists>{},
+                                   entt::type_list_diff_t<Optional, Lists>{}), Lists{}), ...);
+        }
+    };
+
+}
+
+#endif // RUNA_ECS_ARCHETYPES_H
@@ -4,6 +4,7 @@
 #define RUNA_ECS_COMPONENTS_H
 
 #include "../RunaAPI.h"
+#include "../Core/StringPool.h"
 #include <string>
 #include <entt/entt.hpp>
 
@@ -18,9 +19,18 @@ namespace Runa::ECS {
 
 
 
+/**
+ * Position component. prevX/prevY hold the position at the start of the
+ * current fixed tick (see Systems::storePreviousPositions) so rendering can
+ * interpolate between ticks. YAML scenes leave them out; binary scene columns
+ * and registry snapshots copy the whole struct, but EntityRegistry snaps them
+ * to x/y whenever a Position is constructed, so loaded values are discarded.
+ */
 struct RUNA_API Position {
     float x = 0.0f;
     float y = 0.0f;
+    float prevX = 0.0f;
+    float prevY = 0.0f;
 };
 
 
@@ -49,9 +59,13 @@ struct RUNA_API Transform {
 
 
 
+/**
+ * Sprite component. The name is interned so the render pass only touches
+ * 32 bytes per entity; resolve it with StringPool::lookup() when needed.
+ */
 struct RUNA_API Sprite {
     const SpriteSheet* spriteSheet = nullptr;
-    std::string spriteName;
+    StringId spriteName = NullStringId;
     float tintR = 1.0f;
     float tintG = 1.0f;
     float tintB = 1.0f;
@@ -133,8 +147,8 @@ struct RUNA_API Interactable {
     };
     
     Type type = Type::None;
-    std::string data;           // Type-specific data (message, items, etc.)
-    std::string targetScene;    // For teleport
+    StringId data = NullStringId;           // Type-specific data (message, items, etc.), interned
+    StringId targetScene = NullStringId;    // For teleport, interned
     float targetX = 0.0f;       // For teleport
     float targetY = 0.0f;       // For teleport
     float interactionRange = 24.0f;  // How close player must be
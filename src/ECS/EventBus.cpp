@@ -0,0 +1,74 @@
+// File: src/ECS/EventBus.cpp
+
+/**
+ * EventBus.cpp
+ * Thread slot assignment and sync-point dispatch for the event bus.
+ */
+
+#include "../runapch.h"
+#include "EventBus.h"
+#include <atomic>
+#include <bit>
+
+namespace Runa::ECS {
+
+    namespace detail {
+        static_assert(MaxEventThreadSlots == 64, "Slot ownership is one bit per slot in a uint64_t");
+
+        namespace {
+            std::atomic<uint64_t> s_usedSlots{0};
+
+            // Lowest free slot, or MaxEventThreadSlots when every slot is taken
+            uint32_t acquireSlot() {
+                uint64_t used = s_usedSlots.load(std::memory_order_relaxed);
+                while (used != ~uint64_t{0}) {
+                    const uint32_t slot = static_cast<uint32_t>(std::countr_one(used));
+                    if (s_usedSlots.compare_exchange_weak(used, used | (uint64_t{1} << slot),
+                                                          std::memory_order_acquire, std::memory_order_relaxed)) {
+                        return slot;
+                    }
+                }
+                return MaxEventThreadSlots;
+            }
+
+            // Hands the slot back when its thread exits. Events it left unflushed stay in
+            // the buffer and are merged with the next owner's at the sync point
+            struct ThreadSlot {
+                uint32_t index = MaxEventThreadSlots;
+
+                ~ThreadSlot() {
+                    if (index < MaxEventThreadSlots) {
+                        s_usedSlots.fetch_and(~(uint64_t{1} << index), std::memory_order_release);
+                    }
+                }
+            };
+        }
+
+        uint32_t eventThreadSlot() {
+            thread_local ThreadSlot slot;
+            // A thread that found every slot taken retries, so it leaves the overflow path once one frees up
+            if (slot.index >= MaxEventThreadSlots) {
+                slot.index = acquireSlot();
+            }
+            return slot.index;
+        }
+    }
+
+    EventBus& EventBus::get(entt::registry& registry) {
+        return registry.ctx().emplace<EventBus>();
+    }
+
+    void EventBus::dispatch() {
+        // Index loop: handlers may publish a new event type, which appends a channel
+        for (size_t i = 0; i < m_dispatchOrder.size(); ++i) {
+            m_dispatchOrder[i]->dispatch();
+        }
+    }
+
+    void EventBus::clear() {
+        for (auto* channel : m_dispatchOrder) {
+            channel->clear();
+        }
+    }
+
+}
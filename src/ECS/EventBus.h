@@ -0,0 +1,214 @@
+// File: src/ECS/EventBus.h
+
+/**
+ * EventBus.h
+ * Typed, batched event bus. Systems append events to per-type buffers while
+ * they run (each thread into its own buffer, without locking); subscribers
+ * receive each type as one contiguous batch when dispatch() is called.
+ */
+
+#ifndef RUNA_ECS_EVENTBUS_H
+#define RUNA_ECS_EVENTBUS_H
+
+#include "../RunaAPI.h"
+#include <entt/entt.hpp>
+#include <array>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace Runa::ECS {
+
+    namespace detail {
+        // Threads publishing while this many others hold slots share a mutex-protected overflow buffer
+        constexpr uint32_t MaxEventThreadSlots = 64;
+
+        /**
+         * Per-thread slot index, assigned on a thread's first publish and released
+         * when the thread exits, so short-lived threads don't use slots up.
+         * Defined in EventBus.cpp so every module sees the same numbering.
+         */
+        RUNA_API uint32_t eventThreadSlot();
+
+        class EventChannelBase {
+        public:
+            virtual ~EventChannelBase() = default;
+            virtual void flush() = 0;
+            virtual void dispatch() = 0;
+            virtual void clear() = 0;
+        };
+
+        template<typename Event>
+        class EventChannel final : public EventChannelBase {
+        public:
+            using Handler = std::function<void(std::span<const Event>)>;
+
+            void push(Event&& event) {
+                uint32_t slot = eventThreadSlot();
+                if (slot < MaxEventThreadSlots) {
+                    // Only the owning thread appends to its slot, so no synchronization is needed
+                    m_threadBuffers[slot].events.push_back(std::move(event));
+                } else {
+                    std::lock_guard lock(m_overflowMutex);
+                    m_overflow.push_back(std::move(event));
+                }
+            }
+
+            // Merge the per-thread buffers into the contiguous batch (sync point only)
+            void flush() override {
+                for (auto& buffer : m_threadBuffers) {
+                    if (!buffer.events.empty()) {
+                        m_events.insert(m_events.end(), std::make_move_iterator(buffer.events.begin()),
+                                        std::make_move_iterator(buffer.events.end()));
+                        buffer.events.clear();
+                    }
+                }
+                if (!m_overflow.empty()) {
+                    m_events.insert(m_events.end(), std::make_move_iterator(m_overflow.begin()),
+                                    std::make_move_iterator(m_overflow.end()));
+                    m_overflow.clear();
+                }
+            }
+
+            void dispatch() override {
+                flush();
+                if (!m_events.empty()) {
+                    std::span<const Event> batch(m_events);
+                    for (const auto& handler : m_handlers) {
+                        handler(batch);
+                    }
+                }
+                m_events.clear();
+            }
+
+            void clear() override {
+                for (auto& buffer : m_threadBuffers) {
+                    buffer.events.clear();
+                }
+                m_overflow.clear();
+                m_events.clear();
+            }
+
+            std::span<const Event> events() const { return m_events; }
+            void subscribe(Handler handler) { m_handlers.push_back(std::move(handler)); }
+
+        private:
+            // One cache line per slot so appends from different threads don't false-share
+            struct alignas(64) ThreadBuffer {
+                std::vector<Event> events;
+            };
+
+            std::array<ThreadBuffer, MaxEventThreadSlots> m_threadBuffers;
+            std::vector<Event> m_overflow;
+            std::mutex m_overflowMutex;
+
+            std::vector<Event> m_events;
+            std::vector<Handler> m_handlers;
+        };
+    }
+
+    /**
+     * EventWriter - Appends events of one type to the bus.
+     * Resolve a writer once per system run instead of looking up the channel per event.
+     */
+    template<typename Event>
+    class EventWriter {
+    public:
+        explicit EventWriter(detail::EventChannel<Event>& channel) : m_channel(&channel) {}
+
+        void push(Event event) { m_channel->push(std::move(event)); }
+
+        template<typename... Args>
+        void emplace(Args&&... args) { m_channel->push(Event{std::forward<Args>(args)...}); }
+
+    private:
+        detail::EventChannel<Event>* m_channel;
+    };
+
+    /**
+     * EventBus - Lives in the registry context (see get()).
+     * publish()/writer() are safe from any thread while systems run.
+     * subscribe(), flush(), dispatch() and clear() belong to the frame's sync point.
+     */
+    class RUNA_API EventBus {
+    public:
+        template<typename Event>
+        using Handler = typename detail::EventChannel<Event>::Handler;
+
+        EventBus() = default;
+        EventBus(const EventBus&) = delete;
+        EventBus& operator=(const EventBus&) = delete;
+
+        /**
+         * Get the bus stored in the registry context, creating it if needed.
+         */
+        static EventBus& get(entt::registry& registry);
+
+        template<typename Event>
+        EventWriter<Event> writer() {
+            return EventWriter<Event>(assure<Event>());
+        }
+
+        template<typename Event>
+        void publish(Event event) {
+            assure<Event>().push(std::move(event));
+        }
+
+        /**
+         * Register a batch handler. Handlers run in registration order during dispatch().
+         */
+        template<typename Event>
+        void subscribe(Handler<Event> handler) {
+            assure<Event>().subscribe(std::move(handler));
+        }
+
+        /**
+         * Merge pending events of one type and return them without dispatching.
+         * The span stays valid until the next dispatch() or clear().
+         */
+        template<typename Event>
+        std::span<const Event> flush() {
+            auto& channel = assure<Event>();
+            channel.flush();
+            return channel.events();
+        }
+
+        /**
+         * Deliver every pending event to its subscribers as one batch per type, then clear.
+         */
+        void dispatch();
+
+        void clear();
+
+    private:
+        template<typename Event>
+        detail::EventChannel<Event>& assure() {
+            const entt::id_type id = entt::type_hash<Event>::value();
+            {
+                std::shared_lock lock(m_channelMutex);
+                if (auto it = m_channels.find(id); it != m_channels.end()) {
+                    return static_cast<detail::EventChannel<Event>&>(*it->second);
+                }
+            }
+
+            std::unique_lock lock(m_channelMutex);
+            auto& channel = m_channels[id];
+            if (!channel) {
+                channel = std::make_unique<detail::EventChannel<Event>>();
+                m_dispatchOrder.push_back(channel.get());
+            }
+            return static_cast<detail::EventChannel<Event>&>(*channel);
+        }
+
+        std::unordered_map<entt::id_type, std::unique_ptr<detail::EventChannelBase>> m_channels;
+        std::vector<detail::EventChannelBase*> m_dispatchOrder;  // Channel creation order
+        std::shared_mutex m_channelMutex;
+    };
+
+}
+
+#endif // RUNA_ECS_EVENTBUS_H
@@ -0,0 +1,51 @@
+// File: src/ECS/Events.h
+
+/**
+ * Events.h
+ * Event types published to the EventBus by the built-in systems.
+ */
+
+#ifndef RUNA_ECS_EVENTS_H
+#define RUNA_ECS_EVENTS_H
+
+#include "../RunaAPI.h"
+#include "Components.h"
+#include <entt/entt.hpp>
+
+namespace Runa {
+    struct TileInteraction;
+}
+
+namespace Runa::ECS {
+
+    // Entity hit a solid tile in the CollisionMap (updateMapCollision)
+    struct RUNA_API MapCollisionEvent {
+        entt::entity entity = entt::null;
+        CollisionEvent collision;
+    };
+
+    // Two colliders overlapped; collision.other == b (updateEntityToEntityCollision)
+    struct RUNA_API EntityCollisionEvent {
+        entt::entity a = entt::null;
+        entt::entity b = entt::null;
+        CollisionEvent collision;
+    };
+
+    // Interactor used an Interactable entity (updateInteraction).
+    // The component is copied as it was before oneTime consumption.
+    struct RUNA_API InteractionEvent {
+        entt::entity interactor = entt::null;
+        entt::entity target = entt::null;
+        Interactable interactable;
+    };
+
+    // Entity used a tile interaction (updateTileInteraction).
+    // Points into CollisionMap storage; valid until the map is modified.
+    struct RUNA_API TileInteractionEvent {
+        entt::entity entity = entt::null;
+        TileInteraction* interaction = nullptr;
+    };
+
+}
+
+#endif // RUNA_ECS_EVENTS_H
@@ -0,0 +1,88 @@
+// File: src/ECS/Inspector.cpp
+
+/**
+ * Inspector.cpp
+ * Text formatting for reflected component fields.
+ */
+
+#include "../runapch.h"
+#include "Inspector.h"
+#include "Reflection.h"
+#include "../Core/StringPool.h"
+#include <cstdio>
+
+namespace Runa::ECS::Inspector {
+
+namespace {
+
+void appendField(std::string& line, const FieldInfo& field, const void* component) {
+    char value[32];
+    switch (field.type) {
+        case FieldType::Float:
+            std::snprintf(value, sizeof(value), "%.2f", readField<float>(component, field));
+            break;
+        case FieldType::Int:
+            std::snprintf(value, sizeof(value), "%d", readField<int>(component, field));
+            break;
+        case FieldType::UInt32:
+            std::snprintf(value, sizeof(value), "%08X", readField<uint32_t>(component, field));
+            break;
+        case FieldType::Enum:
+            std::snprintf(value, sizeof(value), "%u", readField<uint32_t>(component, field));
+            break;
+        case FieldType::Bool:
+            std::snprintf(value, sizeof(value), "%s", readField<bool>(component, field) ? "true" : "false");
+            break;
+        case FieldType::String:
+            line += ' ';
+            line += field.name;
+            line += '=';
+            line += StringPool::lookup(readField<StringId>(component, field));
+            return;
+    }
+
+    line += ' ';
+    line += field.name;
+    line += '=';
+    line += value;
+}
+
+}
+
+void describeEntity(const entt::registry& registry, entt::entity entity, std::vector<std::string>& lines) {
+    if (!registry.valid(entity)) {
+        lines.emplace_back("Invalid entity");
+        return;
+    }
+
+    lines.push_back("Entity " + std::to_string(entt::to_integral(entity)));
+
+    forEachReflected([&]<typename Type>(uint32_t) {
+        using Info = ComponentInfo<Type>;
+        const auto* storage = registry.storage<Type>();
+        if (!storage || !storage->contains(entity)) {
+            return;
+        }
+
+        std::string line = Info::name;
+        if constexpr (!std::is_empty_v<Type>) {
+            line += ':';
+            const Type& component = storage->get(entity);
+            for (const auto& field : Info::fields) {
+                appendField(line, field, &component);
+            }
+        }
+        lines.push_back(std::move(line));
+    });
+}
+
+void describeStorages(const entt::registry& registry, std::vector<std::string>& lines) {
+    forEachReflected([&]<typename Type>(uint32_t) {
+        const auto* storage = registry.storage<Type>();
+        if (storage && !storage->empty()) {
+            lines.push_back(std::string(ComponentInfo<Type>::name) + ": " + std::to_string(storage->size()));
+        }
+    });
+}
+
+}
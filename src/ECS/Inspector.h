@@ -0,0 +1,28 @@
+// File: src/ECS/Inspector.h
+
+/**
+ * Inspector.h
+ * Debug text views of entities and component storages, generated from the
+ * reflection tables in Reflection.h. TestScene shows them in its text overlay
+ * (toggle with F3).
+ */
+
+#ifndef RUNA_ECS_INSPECTOR_H
+#define RUNA_ECS_INSPECTOR_H
+
+#include "../RunaAPI.h"
+#include <entt/entt.hpp>
+#include <string>
+#include <vector>
+
+namespace Runa::ECS::Inspector {
+
+// Appends one "Name: field=value ..." line per reflected component on the entity
+RUNA_API void describeEntity(const entt::registry& registry, entt::entity entity, std::vector<std::string>& lines);
+
+// Appends one "Name: count" line per non-empty reflected storage, read from the storage sizes
+RUNA_API void describeStorages(const entt::registry& registry, std::vector<std::string>& lines);
+
+}
+
+#endif // RUNA_ECS_INSPECTOR_H
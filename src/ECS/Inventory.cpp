@@ -0,0 +1,168 @@
+// File: src/ECS/Inventory.cpp
+
+/**
+ * Inventory.cpp
+ * Slot storage and open-addressing index maintenance for Inventory.
+ */
+
+#include "../runapch.h"
+#include "Inventory.h"
+
+namespace Runa::ECS {
+
+    namespace {
+        constexpr int IndexMask = Inventory::IndexSize - 1;
+    }
+
+    int Inventory::findBucket(ItemId id) const {
+        if (id == InvalidItemId) {
+            return -1;
+        }
+
+        for (int bucket = bucketFor(id);; bucket = (bucket + 1) & IndexMask) {
+            uint8_t entry = index[bucket];
+            if (entry == 0) {
+                return -1;
+            }
+            if (slots[entry - 1].id == id) {
+                return bucket;
+            }
+        }
+    }
+
+    // An id can own several buckets (one per stack), so moved slots are found by slot, not id
+    int Inventory::bucketOfSlot(int slot) const {
+        int bucket = bucketFor(slots[slot].id);
+        while (index[bucket] != slot + 1) {
+            bucket = (bucket + 1) & IndexMask;
+        }
+        return bucket;
+    }
+
+    int Inventory::findSlot(ItemId id) const {
+        int bucket = findBucket(id);
+        return bucket >= 0 ? index[bucket] - 1 : -1;
+    }
+
+    int Inventory::getCount(ItemId id) const {
+        if (id == InvalidItemId) {
+            return 0;
+        }
+
+        // Every stack of an id sits in the probe chain from its home bucket
+        int total = 0;
+        for (int bucket = bucketFor(id); index[bucket] != 0; bucket = (bucket + 1) & IndexMask) {
+            const ItemStack& stack = slots[index[bucket] - 1];
+            if (stack.id == id) {
+                total += stack.count;
+            }
+        }
+        return total;
+    }
+
+    bool Inventory::addItem(ItemId id, int count, int maxStack) {
+        if (id == InvalidItemId || count <= 0 || maxStack <= 0) {
+            return false;
+        }
+
+        const int limit = std::min(maxStack, 0xFFFF);
+
+        // All or nothing: room left in this id's stacks plus whole stacks in the free slots
+        int room = 0;
+        for (int bucket = bucketFor(id); index[bucket] != 0; bucket = (bucket + 1) & IndexMask) {
+            const ItemStack& stack = slots[index[bucket] - 1];
+            if (stack.id == id) {
+                room += std::max(0, limit - stack.count);
+            }
+        }
+        const int freeSlots = std::max(0, std::min(maxSlots, Capacity) - usedSlots);
+        if (room + freeSlots * limit < count) {
+            return false;
+        }
+
+        // Top up the existing stacks first, then spill the rest into new slots
+        for (int bucket = bucketFor(id); count > 0 && index[bucket] != 0; bucket = (bucket + 1) & IndexMask) {
+            ItemStack& stack = slots[index[bucket] - 1];
+            if (stack.id == id && stack.count < limit) {
+                int moved = std::min(count, limit - stack.count);
+                stack.count = static_cast<uint16_t>(stack.count + moved);
+                count -= moved;
+            }
+        }
+
+        while (count > 0) {
+            int moved = std::min(count, limit);
+            int slot = usedSlots++;
+            slots[slot] = {id, static_cast<uint16_t>(moved)};
+
+            int bucket = bucketFor(id);
+            while (index[bucket] != 0) {
+                bucket = (bucket + 1) & IndexMask;
+            }
+            index[bucket] = static_cast<uint8_t>(slot + 1);
+            count -= moved;
+        }
+        return true;
+    }
+
+    bool Inventory::removeItem(ItemId id, int count) {
+        if (count <= 0) {
+            return false;
+        }
+
+        int bucket = findBucket(id);
+        if (bucket < 0) {
+            return false;
+        }
+
+        while (count > 0 && bucket >= 0) {
+            int slot = index[bucket] - 1;
+            ItemStack& stack = slots[slot];
+            if (stack.count > count) {
+                stack.count = static_cast<uint16_t>(stack.count - count);
+                return true;
+            }
+
+            count -= stack.count;
+            eraseBucket(bucket);
+
+            // Keep slots packed: move the last stack into the freed slot and repoint its bucket
+            int last = --usedSlots;
+            if (slot != last) {
+                int movedBucket = bucketOfSlot(last);
+                slots[slot] = slots[last];
+                index[movedBucket] = static_cast<uint8_t>(slot + 1);
+            }
+            slots[last] = {};
+
+            bucket = findBucket(id);
+        }
+        return true;
+    }
+
+    void Inventory::eraseBucket(int bucket) {
+        // Backward-shift deletion keeps probe chains intact without tombstones
+        index[bucket] = 0;
+
+        int hole = bucket;
+        for (int next = (bucket + 1) & IndexMask; index[next] != 0; next = (next + 1) & IndexMask) {
+            int home = bucketFor(slots[index[next] - 1].id);
+
+            // Move the entry back if its home bucket is not in the cyclic range (hole, next]
+            bool inRange = (hole <= next) ? (hole < home && home <= next)
+                                          : (hole < home || home <= next);
+            if (!inRange) {
+                index[hole] = index[next];
+                index[next] = 0;
+                hole = next;
+            }
+        }
+    }
+
+    void Inventory::clear() {
+        slots.fill({});
+        index.fill(0);
+        usedSlots = 0;
+    }
+
+}
@@ -0,0 +1,88 @@
+// File: src/ECS/Inventory.h
+
+/**
+ * Inventory.h
+ * Fixed-capacity inventory of (ItemId, count) slots with an open-addressing
+ * index for O(1) lookup. Trivially copyable, no heap allocations.
+ */
+
+#ifndef RUNA_ECS_INVENTORY_H
+#define RUNA_ECS_INVENTORY_H
+
+#include "../RunaAPI.h"
+#include "ItemDatabase.h"
+#include <array>
+#include <cstdint>
+
+namespace Runa::ECS {
+
+    struct RUNA_API ItemStack {
+        ItemId id = InvalidItemId;
+        uint16_t count = 0;
+    };
+
+    struct RUNA_API Inventory {
+        static constexpr int Capacity = 32;
+
+        // Power of two, kept at >= 2x Capacity so linear probe chains stay short
+        static constexpr int IndexSize = 64;
+
+        // Occupied slots are packed at the front: [0, usedSlots)
+        std::array<ItemStack, Capacity> slots{};
+
+        // Maps hash(id) -> slot + 1; 0 marks an empty bucket
+        std::array<uint8_t, IndexSize> index{};
+
+        int usedSlots = 0;
+        int maxSlots = 20;
+        int gold = 0;
+
+        /**
+         * Add items to this id's stacks up to maxStack each, spilling the rest
+         * into new slots. Nothing is added unless all of it fits.
+         * @return false if count is not positive or there are not enough free slots
+         */
+        bool addItem(ItemId id, int count = 1, int maxStack = 99);
+
+        /**
+         * Remove up to count items across this id's stacks; a slot is freed when its
+         * count reaches zero.
+         * @return false if count is not positive or the item is not present
+         */
+        bool removeItem(ItemId id, int count = 1);
+
+        bool hasItem(ItemId id, int count = 1) const { return getCount(id) >= count; }
+
+        // Total over every stack of this id
+        int getCount(ItemId id) const;
+
+        /**
+         * @return A slot holding this id, or -1
+         */
+        int findSlot(ItemId id) const;
+
+        int size() const { return usedSlots; }
+        bool empty() const { return usedSlots == 0; }
+        void clear();
+
+        const ItemStack* begin() const { return slots.data(); }
+        const ItemStack* end() const { return slots.data() + usedSlots; }
+
+    private:
+        static int bucketFor(ItemId id) {
+            // Fibonacci hashing, top bits of the product select the bucket (IndexSize = 2^6)
+            return static_cast<int>((static_cast<uint32_t>(id) * 2654435769u) >> 26);
+        }
+
+        int findBucket(ItemId id) const;
+        int bucketOfSlot(int slot) const;
+        void eraseBucket(int bucket);
+    };
+
+    static_assert((Inventory::IndexSize & (Inventory::IndexSize - 1)) == 0, "IndexSize must be a power of two");
+    static_assert(Inventory::IndexSize == 64, "bucketFor() shift assumes 64 buckets");
+    static_assert(Inventory::IndexSize >= 2 * Inventory::Capacity, "Index load factor must stay <= 0.5");
+
+}
+
+#endif // RUNA_ECS_INVENTORY_H
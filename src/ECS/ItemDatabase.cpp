@@ -0,0 +1,117 @@
+// File: src/ECS/ItemDatabase.cpp
+
+/**
+ * ItemDatabase.cpp
+ * Loading and lookup for the global item definition table.
+ */
+
+#include "../runapch.h"
+#include "ItemDatabase.h"
+#include "../Core/Log.h"
+#include <limits>
+#include <yaml-cpp/yaml.h>
+
+namespace Runa::ECS {
+
+    // Slot 0 is the invalid item so ids can index the table directly
+    std::vector<ItemDefinition> ItemDatabase::s_items(1);
+    std::unordered_map<StringId, ItemId> ItemDatabase::s_keyToId;
+
+    int ItemDatabase::loadFromFile(const std::string& filePath) {
+        try {
+            YAML::Node root = YAML::LoadFile(filePath);
+
+            if (!root["items"] || !root["items"].IsSequence()) {
+                LOG_WARN("ItemDatabase: No 'items' sequence in {}", filePath);
+                return 0;
+            }
+
+            int count = 0;
+            for (const auto& itemNode : root["items"]) {
+                std::string key = itemNode["key"].as<std::string>("");
+                if (key.empty()) {
+                    LOG_WARN("ItemDatabase: Skipping item without 'key' in {}", filePath);
+                    continue;
+                }
+
+                ItemDefinition def;
+                def.name = itemNode["name"].as<std::string>(key);
+                def.description = itemNode["description"].as<std::string>("");
+                def.type = parseItemType(itemNode["type"].as<std::string>("potion"));
+                def.value = itemNode["value"].as<int>(0);
+                def.maxStack = itemNode["max_stack"].as<int>(99);
+                def.healAmount = itemNode["heal_amount"].as<float>(0.0f);
+                def.damageBonus = itemNode["damage_bonus"].as<float>(0.0f);
+
+                if (registerItem(def, key) != InvalidItemId) {
+                    count++;
+                }
+            }
+
+            LOG_INFO("Loaded {} item definitions from: {}", count, filePath);
+            return count;
+
+        } catch (const YAML::Exception& e) {
+            LOG_ERROR("YAML error while loading items from {}: {}", filePath, e.what());
+            return 0;
+        } catch (const std::exception& e) {
+            LOG_ERROR("Exception while loading items from {}: {}", filePath, e.what());
+            return 0;
+        }
+    }
+
+    ItemId ItemDatabase::registerItem(const ItemDefinition& definition, const std::string& key) {
+        if (key.empty()) {
+            return InvalidItemId;
+        }
+
+        StringId keyId = StringPool::intern(key);
+
+        auto it = s_keyToId.find(keyId);
+        if (it != s_keyToId.end()) {
+            ItemDefinition& existing = s_items[it->second];
+            existing = definition;
+            existing.id = it->second;
+            existing.key = keyId;
+            existing.maxStack = std::max(existing.maxStack, 1);
+            return it->second;
+        }
+
+        if (s_items.size() > std::numeric_limits<ItemId>::max()) {
+            LOG_ERROR("ItemDatabase: Item table full, cannot register '{}'", key);
+            return InvalidItemId;
+        }
+
+        ItemId id = static_cast<ItemId>(s_items.size());
+        ItemDefinition& added = s_items.emplace_back(definition);
+        added.id = id;
+        added.key = keyId;
+        added.maxStack = std::max(added.maxStack, 1);
+        s_keyToId.emplace(keyId, id);
+        return id;
+    }
+
+    ItemId ItemDatabase::findId(const std::string& key) {
+        return findId(StringPool::find(key));
+    }
+
+    ItemId ItemDatabase::findId(StringId key) {
+        auto it = s_keyToId.find(key);
+        return it != s_keyToId.end() ? it->second : InvalidItemId;
+    }
+
+    void ItemDatabase::clear() {
+        s_items.resize(1);
+        s_keyToId.clear();
+    }
+
+    ItemType ItemDatabase::parseItemType(const std::string& type) {
+        if (type == "coin") return ItemType::Coin;
+        if (type == "key") return ItemType::Key;
+        if (type == "weapon") return ItemType::Weapon;
+        if (type == "armor") return ItemType::Armor;
+        if (type == "quest_item" || type == "quest") return ItemType::QuestItem;
+        return ItemType::Potion;
+    }
+
+}
@@ -0,0 +1,91 @@
+// File: src/ECS/ItemDatabase.h
+
+/**
+ * ItemDatabase.h
+ * Global item definition table. Items are loaded once from YAML and referenced
+ * everywhere else by a 16-bit ItemId; names and descriptions stay in the table.
+ */
+
+#ifndef RUNA_ECS_ITEMDATABASE_H
+#define RUNA_ECS_ITEMDATABASE_H
+
+#include "../RunaAPI.h"
+#include "../Core/StringPool.h"
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Runa::ECS {
+
+    using ItemId = uint16_t;
+
+    // Id 0 is never assigned to a definition
+    constexpr ItemId InvalidItemId = 0;
+
+    enum class ItemType : uint8_t {
+        Potion,
+        Coin,
+        Key,
+        Weapon,
+        Armor,
+        QuestItem
+    };
+
+    struct RUNA_API ItemDefinition {
+        ItemId id = InvalidItemId;
+        StringId key = NullStringId;    // Interned lookup key, also used as quest objective target
+        ItemType type = ItemType::Potion;
+        std::string name;
+        std::string description;
+        int value = 0;
+        int maxStack = 99;
+
+
+        float healAmount = 0.0f;
+        float damageBonus = 0.0f;
+
+        bool isConsumable() const {
+            return type == ItemType::Potion;
+        }
+    };
+
+    /**
+     * ItemDatabase - Static table of item definitions indexed by ItemId.
+     * Populate it during initialization; lookups are not synchronized against registration.
+     */
+    class RUNA_API ItemDatabase {
+    public:
+        /**
+         * Load item definitions from a YAML file (see Resources/items.yaml).
+         * Items whose key already exists are updated in place and keep their id.
+         * @return Number of definitions loaded
+         */
+        static int loadFromFile(const std::string& filePath);
+
+        /**
+         * Register a single definition. The id field is ignored and assigned here.
+         * @return The item's id, or InvalidItemId if the key is empty or the table is full
+         */
+        static ItemId registerItem(const ItemDefinition& definition, const std::string& key);
+
+        static const ItemDefinition* get(ItemId id) {
+            return (id != InvalidItemId && id < s_items.size()) ? &s_items[id] : nullptr;
+        }
+
+        static ItemId findId(const std::string& key);
+        static ItemId findId(StringId key);
+
+        static size_t size() { return s_items.empty() ? 0 : s_items.size() - 1; }
+        static void clear();
+
+        static ItemType parseItemType(const std::string& type);
+
+    private:
+        static std::vector<ItemDefinition> s_items;
+        static std::unordered_map<StringId, ItemId> s_keyToId;
+    };
+
+}
+
+#endif // RUNA_ECS_ITEMDATABASE_H
@@ -0,0 +1,146 @@
+// File: src/ECS/Prefab.cpp
+
+/**
+ * Prefab.cpp
+ * Batch instantiation and YAML loading of prefabs.
+ */
+
+#include "../runapch.h"
+#include "Prefab.h"
+#include "Reflection.h"
+#include "../Core/Log.h"
+#include "../Core/SceneSerializer.h"
+#include <yaml-cpp/yaml.h>
+
+namespace Runa::ECS {
+
+    std::unordered_map<StringId, std::unique_ptr<Prefab>> PrefabLibrary::s_prefabs;
+
+    size_t Prefab::instantiate(entt::registry& registry, size_t count, std::span<const Position> positions,
+                               std::vector<entt::entity>& out) const {
+        if (count == 0) {
+            return 0;
+        }
+        if (!positions.empty() && positions.size() != count) {
+            LOG_ERROR("Prefab '{}': {} positions given for {} instances", m_name, positions.size(), count);
+            return 0;
+        }
+
+        const size_t start = out.size();
+        out.resize(start + count);
+        const entt::entity* first = out.data() + start;
+        const entt::entity* last = first + count;
+
+        registry.create(out.begin() + static_cast<std::ptrdiff_t>(start), out.end());
+        insertComponent<Active>(registry, first, last, nullptr);
+
+        for (const auto& component : m_components) {
+            if (!positions.empty() && component.type == entt::type_hash<Position>::value()) {
+                continue;
+            }
+            component.insert(registry, first, last, component.value.get());
+        }
+
+        if (!positions.empty()) {
+            auto& storage = registry.storage<Position>();
+            storage.reserve(storage.size() + count);
+            storage.insert(first, last, positions.begin());
+        }
+
+        return count;
+    }
+
+    std::vector<entt::entity> Prefab::instantiate(entt::registry& registry, size_t count,
+                                                  std::span<const Position> positions) const {
+        std::vector<entt::entity> entities;
+        entities.reserve(count);
+        instantiate(registry, count, positions, entities);
+        return entities;
+    }
+
+    int PrefabLibrary::loadFromFile(const std::string& filePath) {
+        try {
+            YAML::Node root = YAML::LoadFile(filePath);
+
+            if (!root["prefabs"] || !root["prefabs"].IsSequence()) {
+                LOG_WARN("PrefabLibrary: No 'prefabs' sequence in {}", filePath);
+                return 0;
+            }
+
+            int count = 0;
+            for (const auto& prefabNode : root["prefabs"]) {
+                std::string name = prefabNode["name"].as<std::string>("");
+                if (name.empty()) {
+                    LOG_WARN("PrefabLibrary: Skipping prefab without 'name' in {}", filePath);
+                    continue;
+                }
+
+                Prefab prefab(name);
+                const YAML::Node components = prefabNode["components"];
+                if (components && components.IsMap()) {
+                    for (const auto& entry : components) {
+                        std::string componentName = entry.first.as<std::string>("");
+                        if (!findComponentDescriptor(componentName)) {
+                            LOG_WARN("PrefabLibrary: Unknown component '{}' in prefab '{}'", componentName, name);
+                        }
+                    }
+
+                    // Compile each listed component to its default value overridden by the YAML fields
+                    forEachReflected([&]<typename Type>(uint32_t) {
+                        using Info = ComponentInfo<Type>;
+                        const YAML::Node componentNode = components[Info::name];
+                        if (!componentNode) {
+                            return;
+                        }
+
+                        Type value{};
+                        if constexpr (!std::is_empty_v<Type>) {
+                            SceneSerializer::deserializeComponent(Info::name, &value, componentNode);
+                        }
+                        prefab.set<Type>(value);
+                    });
+                }
+
+                registerPrefab(std::move(prefab));
+                count++;
+            }
+
+            LOG_INFO("Loaded {} prefabs from: {}", count, filePath);
+            return count;
+
+        } catch (const YAML::Exception& e) {
+            LOG_ERROR("YAML error while loading prefabs from {}: {}", filePath, e.what());
+            return 0;
+        } catch (const std::exception& e) {
+            LOG_ERROR("Exception while loading prefabs from {}: {}", filePath, e.what());
+            return 0;
+        }
+    }
+
+    Prefab& PrefabLibrary::registerPrefab(Prefab prefab) {
+        StringId key = StringPool::intern(prefab.getName());
+        auto& slot = s_prefabs[key];
+        slot = std::make_unique<Prefab>(std::move(prefab));
+        return *slot;
+    }
+
+    const Prefab* PrefabLibrary::get(const std::string& name) {
+        StringId key = StringPool::find(name);
+        return key == NullStringId ? nullptr : get(key);
+    }
+
+    const Prefab* PrefabLibrary::get(StringId name) {
+        auto it = s_prefabs.find(name);
+        return it != s_prefabs.end() ? it->second.get() : nullptr;
+    }
+
+    Prefab* PrefabLibrary::getMutable(const std::string& name) {
+        StringId key = StringPool::find(name);
+        if (key == NullStringId) {
+            return nullptr;
+        }
+        auto it = s_prefabs.find(key);
+        return it != s_prefabs.end() ? it->second.get() : nullptr;
+    }
+
+}
@@ -0,0 +1,157 @@
+// File: src/ECS/Prefab.h
+
+/**
+ * Prefab.h
+ * Entity templates. A Prefab holds one value per component type; instantiating
+ * it creates a whole batch of entities with EnTT's range create() and fills
+ * each component storage with a single range insert().
+ */
+
+#ifndef RUNA_ECS_PREFAB_H
+#define RUNA_ECS_PREFAB_H
+
+#include "../RunaAPI.h"
+#include "../Core/StringPool.h"
+#include "Components.h"
+#include <entt/entt.hpp>
+#include <memory>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Runa::ECS {
+
+    /**
+     * Prefab - Compiled component template.
+     * Every instance gets Active plus each component set on the prefab.
+     * Sprite::spriteSheet is copied as-is, so set it in code after loading
+     * from YAML if the prefab should render with a sheet.
+     */
+    class RUNA_API Prefab {
+    public:
+        explicit Prefab(std::string name = "") : m_name(std::move(name)) {}
+
+        // Add a component to the template, or replace its value
+        template<typename Component>
+        Prefab& set(const Component& value = {}) {
+            static_assert(std::is_copy_constructible_v<Component>, "Prefab components must be copyable");
+            static_assert(!std::is_same_v<Component, Active>, "Every prefab instance gets Active already");
+
+            const entt::id_type type = entt::type_hash<Component>::value();
+            for (auto& entry : m_components) {
+                if (entry.type == type) {
+                    entry.value = makeValue(value);
+                    return *this;
+                }
+            }
+            m_components.push_back({type, makeValue(value), &insertComponent<Component>});
+            return *this;
+        }
+
+        template<typename Component>
+        const Component* find() const {
+            const entt::id_type type = entt::type_hash<Component>::value();
+            for (const auto& entry : m_components) {
+                if (entry.type == type) {
+                    return std::is_empty_v<Component> ? nullptr : static_cast<const Component*>(entry.value.get());
+                }
+            }
+            return nullptr;
+        }
+
+        template<typename Component>
+        bool has() const {
+            const entt::id_type type = entt::type_hash<Component>::value();
+            for (const auto& entry : m_components) {
+                if (entry.type == type) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /**
+         * Create count entities from the template and append them to out.
+         * @param positions Empty, or one Position per instance (overrides the template's Position)
+         * @return Number of entities created (0 if positions has the wrong size)
+         */
+        size_t instantiate(entt::registry& registry, size_t count, std::span<const Position> positions,
+                           std::vector<entt::entity>& out) const;
+
+        // Convenience overload returning the created entities
+        std::vector<entt::entity> instantiate(entt::registry& registry, size_t count,
+                                              std::span<const Position> positions = {}) const;
+
+        const std::string& getName() const { return m_name; }
+        size_t getComponentCount() const { return m_components.size(); }
+
+    private:
+        using InsertFn = void (*)(entt::registry& registry, const entt::entity* first, const entt::entity* last,
+                                  const void* value);
+
+        struct ComponentTemplate {
+            entt::id_type type;
+            std::shared_ptr<const void> value;     // nullptr for tags
+            InsertFn insert;
+        };
+
+        template<typename Component>
+        static std::shared_ptr<const void> makeValue(const Component& value) {
+            if constexpr (std::is_empty_v<Component>) {
+                return nullptr;
+            } else {
+                return std::make_shared<const Component>(value);
+            }
+        }
+
+        // Reserve once, then fill the whole range with one insert
+        template<typename Component>
+        static void insertComponent(entt::registry& registry, const entt::entity* first, const entt::entity* last,
+                                    const void* value) {
+            auto& storage = registry.storage<Component>();
+            storage.reserve(storage.size() + static_cast<size_t>(last - first));
+            if constexpr (std::is_empty_v<Component>) {
+                storage.insert(first, last);
+            } else {
+                storage.insert(first, last, *static_cast<const Component*>(value));
+            }
+        }
+
+        std::string m_name;
+        std::vector<ComponentTemplate> m_components;
+    };
+
+    /**
+     * PrefabLibrary - Global table of prefabs keyed by interned name.
+     * Populate it during initialization; lookups are not synchronized against registration.
+     */
+    class RUNA_API PrefabLibrary {
+    public:
+        /**
+         * Load prefab definitions from a YAML file (see Resources/prefabs.yaml).
+         * Component values use the same field names as scene files; any reflected
+         * component can be listed. A prefab whose name already exists is replaced.
+         * @return Number of prefabs loaded
+         */
+        static int loadFromFile(const std::string& filePath);
+
+        // Register (or replace) a prefab built in code
+        static Prefab& registerPrefab(Prefab prefab);
+
+        static const Prefab* get(const std::string& name);
+        static const Prefab* get(StringId name);
+        static Prefab* getMutable(const std::string& name);
+
+        static size_t size() { return s_prefabs.size(); }
+        static void clear() { s_prefabs.clear(); }
+
+    private:
+        static std::unordered_map<StringId, std::unique_ptr<Prefab>> s_prefabs;
+    };
+
+}
+
+#endif // RUNA_ECS_PREFAB_H
@@ -0,0 +1,173 @@
+// File: src/ECS/QuestTracker.cpp
+
+/**
+ * QuestTracker.cpp
+ * Implementation of the indexed quest objective tracker.
+ */
+
+#include "../runapch.h"
+#include "QuestTracker.h"
+#include "../Core/Log.h"
+
+namespace Runa::ECS {
+
+    QuestTracker& QuestTracker::get(entt::registry& registry) {
+        return registry.ctx().emplace<QuestTracker>();
+    }
+
+    bool QuestTracker::startQuest(entt::registry& registry, entt::entity questGiver) {
+        auto* giver = registry.try_get<QuestGiver>(questGiver);
+        if (!giver || giver->quest.status != QuestStatus::NotStarted) {
+            return false;
+        }
+
+        auto& quest = giver->quest;
+        quest.status = QuestStatus::InProgress;
+        giver->questGiven = true;
+
+        subscribe(questGiver, quest);
+
+        // Checked on the next update, so quests without objectives complete immediately
+        m_dirty.push_back(questGiver);
+
+        LOG_DEBUG("QuestTracker: started '{}' ({} objectives)", StringPool::lookup(quest.id), quest.objectiveCount);
+        return true;
+    }
+
+    void QuestTracker::update(entt::registry& registry, std::vector<entt::entity>& completed) {
+        if (!m_events.empty()) {
+            // Coalesce events with the same (type, target) so each subscriber list is walked once per batch
+            std::sort(m_events.begin(), m_events.end(), [](const QuestEvent& a, const QuestEvent& b) {
+                return makeKey(a.type, a.target) < makeKey(b.type, b.target);
+            });
+
+            size_t i = 0;
+            while (i < m_events.size()) {
+                const QuestEvent& first = m_events[i];
+                uint64_t key = makeKey(first.type, first.target);
+
+                int amount = 0;
+                size_t j = i;
+                for (; j < m_events.size() && makeKey(m_events[j].type, m_events[j].target) == key; ++j) {
+                    amount += m_events[j].amount;
+                }
+
+                applyEvent(registry, key, amount);
+                if (first.target != NullStringId) {
+                    applyEvent(registry, makeKey(first.type, NullStringId), amount);
+                }
+
+                i = j;
+            }
+
+            m_events.clear();
+        }
+
+        if (m_dirty.empty()) {
+            return;
+        }
+
+        std::sort(m_dirty.begin(), m_dirty.end());
+        m_dirty.erase(std::unique(m_dirty.begin(), m_dirty.end()), m_dirty.end());
+
+        for (auto entity : m_dirty) {
+            if (!registry.valid(entity)) continue;
+
+            auto* giver = registry.try_get<QuestGiver>(entity);
+            if (!giver) continue;
+
+            if (giver->quest.status == QuestStatus::InProgress && giver->quest.isComplete()) {
+                unsubscribe(entity, giver->quest);
+                completed.push_back(entity);
+            }
+        }
+
+        m_dirty.clear();
+    }
+
+    void QuestTracker::clear() {
+        m_subscriptions.clear();
+        m_events.clear();
+        m_dirty.clear();
+    }
+
+    void QuestTracker::rebuild(entt::registry& registry) {
+        clear();
+
+        for (auto [entity, giver] : registry.view<QuestGiver>().each()) {
+            if (giver.quest.status == QuestStatus::InProgress) {
+                subscribe(entity, giver.quest);
+                m_dirty.push_back(entity);
+            }
+        }
+
+        LOG_DEBUG("QuestTracker: rebuilt {} subscriptions", getSubscriptionCount());
+    }
+
+    size_t QuestTracker::getSubscriptionCount() const {
+        size_t count = 0;
+        for (const auto& [key, subs] : m_subscriptions) {
+            count += subs.size();
+        }
+        return count;
+    }
+
+    void QuestTracker::applyEvent(entt::registry& registry, uint64_t key, int amount) {
+        auto it = m_subscriptions.find(key);
+        if (it == m_subscriptions.end()) {
+            return;
+        }
+
+        auto& subs = it->second;
+        for (size_t i = 0; i < subs.size();) {
+            const Subscription sub = subs[i];
+
+            auto* giver = registry.valid(sub.questGiver) ? registry.try_get<QuestGiver>(sub.questGiver) : nullptr;
+            if (!giver || giver->quest.status != QuestStatus::InProgress ||
+                sub.objective >= static_cast<uint32_t>(giver->quest.objectiveCount)) {
+                // Quest giver was destroyed or the quest was reset behind our back
+                subs[i] = subs.back();
+                subs.pop_back();
+                continue;
+            }
+
+            auto& objective = giver->quest.objectives[sub.objective];
+            if (!objective.isMet()) {
+                objective.progress = std::min(objective.progress + amount, objective.required);
+                m_dirty.push_back(sub.questGiver);
+            }
+            ++i;
+        }
+
+        if (subs.empty()) {
+            m_subscriptions.erase(it);
+        }
+    }
+
+    void QuestTracker::subscribe(entt::entity questGiver, const Quest& quest) {
+        for (uint32_t i = 0; i < static_cast<uint32_t>(quest.objectiveCount); ++i) {
+            const auto& objective = quest.objectives[i];
+            if (!objective.isMet()) {
+                m_subscriptions[makeKey(objective.type, objective.target)].push_back({questGiver, i});
+            }
+        }
+    }
+
+    void QuestTracker::unsubscribe(entt::entity questGiver, const Quest& quest) {
+        for (uint32_t i = 0; i < static_cast<uint32_t>(quest.objectiveCount); ++i) {
+            const auto& objective = quest.objectives[i];
+            auto it = m_subscriptions.find(makeKey(objective.type, objective.target));
+            if (it == m_subscriptions.end()) continue;
+
+            auto& subs = it->second;
+            subs.erase(std::remove_if(subs.begin(), subs.end(), [&](const Subscription& sub) {
+                return sub.questGiver == questGiver && sub.objective == i;
+            }), subs.end());
+
+            if (subs.empty()) {
+                m_subscriptions.erase(it);
+            }
+        }
+    }
+
+}
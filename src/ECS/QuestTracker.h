@@ -0,0 +1,89 @@
+// File: src/ECS/QuestTracker.h
+
+/**
+ * QuestTracker.h
+ * Event-driven quest progress tracking. Active quest objectives are indexed by
+ * (objective type, target id), so kill and pickup events only touch the quests
+ * that subscribed to them instead of scanning every QuestGiver.
+ */
+
+#ifndef RUNA_ECS_QUESTTRACKER_H
+#define RUNA_ECS_QUESTTRACKER_H
+
+#include "../RunaAPI.h"
+#include "../Core/StringPool.h"
+#include "RPGComponents.h"
+#include <entt/entt.hpp>
+#include <unordered_map>
+#include <vector>
+
+namespace Runa::ECS {
+
+    struct RUNA_API QuestEvent {
+        QuestObjectiveType type = QuestObjectiveType::Kill;
+        StringId target = NullStringId;
+        int amount = 1;
+    };
+
+    /**
+     * QuestTracker - Lives in the registry context (see get()).
+     * Gameplay systems queue events during the frame; update() drains the queue
+     * in one batch and only re-checks completion for quests whose counters changed.
+     */
+    class RUNA_API QuestTracker {
+    public:
+        /**
+         * Get the tracker stored in the registry context, creating it if needed.
+         */
+        static QuestTracker& get(entt::registry& registry);
+
+        /**
+         * Mark the quest on a QuestGiver entity as in progress and subscribe its objectives.
+         * @return false if the entity has no QuestGiver or the quest was already started
+         */
+        bool startQuest(entt::registry& registry, entt::entity questGiver);
+
+        void pushKill(StringId enemyKind) { m_events.push_back({QuestObjectiveType::Kill, enemyKind, 1}); }
+        void pushPickup(StringId item, int count = 1) { m_events.push_back({QuestObjectiveType::Collect, item, count}); }
+
+        /**
+         * Apply all queued events to subscribed objectives.
+         * @param registry ECS registry owning the QuestGiver components
+         * @param completed Receives the QuestGiver entities whose quests became complete
+         */
+        void update(entt::registry& registry, std::vector<entt::entity>& completed);
+
+        void clear();
+
+        /**
+         * Drop all subscriptions and queued events, then re-subscribe every in-progress
+         * quest's unmet objectives. Call after the QuestGiver components were replaced
+         * wholesale, e.g. by RegistrySnapshot::restore().
+         */
+        void rebuild(entt::registry& registry);
+
+        size_t getPendingEventCount() const { return m_events.size(); }
+        size_t getSubscriptionCount() const;
+
+    private:
+        struct Subscription {
+            entt::entity questGiver = entt::null;
+            uint32_t objective = 0;
+        };
+
+        static uint64_t makeKey(QuestObjectiveType type, StringId target) {
+            return (static_cast<uint64_t>(type) << 32) | target;
+        }
+
+        void applyEvent(entt::registry& registry, uint64_t key, int amount);
+        void subscribe(entt::entity questGiver, const Quest& quest);
+        void unsubscribe(entt::entity questGiver, const Quest& quest);
+
+        std::unordered_map<uint64_t, std::vector<Subscription>> m_subscriptions;
+        std::vector<QuestEvent> m_events;
+        std::vector<entt::entity> m_dirty;
+    };
+
+}
+
+#endif // RUNA_ECS_QUESTTRACKER_H
@@ -9,6 +9,11 @@
 #define RUNA_ECS_RPGCOMPONENTS_H
 
 #include "../RunaAPI.h"
+#include "../Core/StringPool.h"
+#include "Inventory.h"
+#include "ItemDatabase.h"
+#include <array>
+#include <span>
 #include <string>
 #include <vector>
 #include <functional>
@@ -88,83 +93,12 @@ namespace Runa {
 
 
 
-    enum class ItemType {
-        Potion,
-        Coin,
-        Key,
-        Weapon,
-        Armor,
-        QuestItem
-    };
-
-    struct RUNA_API Item {
-        ItemType type;
-        std::string name;
-        std::string description;
-        int value = 0;
-        int stackSize = 1;
-
-
-        float healAmount = 0.0f;
-        float damageBonus = 0.0f;
-
-        bool isConsumable() const {
-            return type == ItemType::Potion;
-        }
-    };
-
+    // Item definitions live in ItemDatabase; entities only carry ids and counts
     struct RUNA_API DroppedItem {
-        Item item;
+        ItemStack stack;
         bool collected = false;
     };
 
-    struct RUNA_API Inventory {
-        std::vector<Item> items;
-        int maxSlots = 20;
-        int gold = 0;
-
-        bool addItem(const Item& item) {
-
-            if (item.type == ItemType::Coin) {
-                gold += item.value;
-                return true;
-            }
-
-
-            for (auto& existingItem : items) {
-                if (existingItem.name == item.name && existingItem.stackSize < 99) {
-                    existingItem.stackSize += item.stackSize;
-                    return true;
-                }
-            }
-
-
-            if (items.size() < static_cast<size_t>(maxSlots)) {
-                items.push_back(item);
-                return true;
-            }
-
-            return false;
-        }
-
-        bool hasItem(const std::string& itemName) const {
-            for (const auto& item : items) {
-                if (item.name == itemName) return true;
-            }
-            return false;
-        }
-
-        bool removeItem(const std::string& itemName) {
-            for (auto it = items.begin(); it != items.end(); ++it) {
-                if (it->name == itemName) {
-                    items.erase(it);
-                    return true;
-                }
-            }
-            return false;
-        }
-    };
-
 
 
     enum class QuestStatus {
@@ -174,34 +108,77 @@ namespace Runa {
         Failed
     };
 
+    enum class QuestObjectiveType : uint8_t {
+        Kill,
+        Collect
+    };
+
+    /**
+     * A single counted objective. The target is an interned id (enemy kind or
+     * item key); NullStringId matches any target of the objective's type.
+     */
+    struct RUNA_API QuestObjective {
+        QuestObjectiveType type = QuestObjectiveType::Kill;
+        StringId target = NullStringId;
+        int required = 1;
+        int progress = 0;
+
+        bool isMet() const { return progress >= required; }
+    };
+
+    // Display text is interned; resolve with StringPool::lookup() when shown.
+    // Objectives and rewards are fixed-capacity so QuestGiver stays trivially
+    // copyable and can be captured by RegistrySnapshot.
     struct RUNA_API Quest {
-        std::string id;
-        std::string title;
-        std::string description;
+        static constexpr int MaxObjectives = 4;
+        static constexpr int MaxItemRewards = 4;
+
+        StringId id = NullStringId;
+        StringId title = NullStringId;
+        StringId description = NullStringId;
         QuestStatus status = QuestStatus::NotStarted;
 
 
-        int enemiesKilled = 0;
-        int enemiesRequired = 0;
-        std::vector<std::string> itemsRequired;
-        std::vector<std::string> itemsCollected;
+        std::array<QuestObjective, MaxObjectives> objectives{};
+        int objectiveCount = 0;
 
 
         int xpReward = 100;
         int goldReward = 50;
-        std::vector<Item> itemRewards;
+        std::array<ItemStack, MaxItemRewards> itemRewards{};
+        int itemRewardCount = 0;
+
+        // @return false if the quest already has MaxObjectives objectives
+        bool addObjective(QuestObjectiveType type, const std::string& target, int required) {
+            if (objectiveCount >= MaxObjectives) return false;
+            objectives[objectiveCount++] = {type, StringPool::intern(target), required, 0};
+            return true;
+        }
+
+        // @return false if the quest already has MaxItemRewards rewards
+        bool addItemReward(ItemId item, int count) {
+            if (itemRewardCount >= MaxItemRewards) return false;
+            itemRewards[itemRewardCount++] = {item, static_cast<uint16_t>(count)};
+            return true;
+        }
+
+        std::span<QuestObjective> getObjectives() { return {objectives.data(), static_cast<size_t>(objectiveCount)}; }
+        std::span<const QuestObjective> getObjectives() const { return {objectives.data(), static_cast<size_t>(objectiveCount)}; }
+        std::span<const ItemStack> getItemRewards() const { return {itemRewards.data(), static_cast<size_t>(itemRewardCount)}; }
 
         bool isComplete() const {
             if (status == QuestStatus::Completed) return true;
-            if (enemiesRequired > 0 && enemiesKilled < enemiesRequired) return false;
-            if (!itemsRequired.empty() && itemsCollected.size() < itemsRequired.size()) return false;
-            return status == QuestStatus::InProgress;
+            if (status != QuestStatus::InProgress) return false;
+            for (const auto& objective : getObjectives()) {
+                if (!objective.isMet()) return false;
+            }
+            return true;
         }
     };
 
     struct RUNA_API QuestGiver {
-        std::string npcName;
-        std::string dialogueText;
+        StringId npcName = NullStringId;
+        StringId dialogueText = NullStringId;
         Quest quest;
         bool questGiven = false;
         bool questCompleted = false;
@@ -218,10 +195,31 @@ namespace Runa {
         bool isCritical = false;
     };
 
+    // Short tint towards a colour after a hit, drawn through Sprite::tint. Tint is
+    // per instance, so flashing sprites still batch with everything else
+    struct RUNA_API DamageFlash {
+        float duration = 0.2f;
+        float elapsed = 0.0f;
+        float r = 1.0f;
+        float g = 0.2f;
+        float b = 0.2f;
+
+        // Sprite tint to restore when the flash ends
+        float baseR = 1.0f;
+        float baseG = 1.0f;
+        float baseB = 1.0f;
+    };
+
 
 
     struct RUNA_API Player {};
     struct RUNA_API Enemy {};
+
+    // Interned enemy type name, reported with kill events for quest objectives
+    struct RUNA_API EnemyKind {
+        StringId id = NullStringId;
+    };
+
     struct RUNA_API NPC {};
     struct RUNA_API ItemEntity {};
 
@@ -8,7 +8,9 @@
 #include "runapch.h"
 #include "RPGSystems.h"
 #include "Components.h"
+#include "QuestTracker.h"
 #include "../Core/Log.h"
+#include "../Core/Random.h"
 #include <cmath>
 #include <algorithm>
 
@@ -53,6 +55,7 @@ void updateCombat(entt::registry& registry, float dt, float gameTime) {
 			auto damageNum = registry.create();
 			registry.emplace<Position>(damageNum, enemyPos.x, enemyPos.y);
 			registry.emplace<DamageNumber>(damageNum, playerCombat.damage, 1.0f, 0.0f, 0.0f, false);
+			startDamageFlash(registry, enemyEntity);
 
 			LOG_DEBUG("Player dealt {} damage to enemy", playerCombat.damage);
 
@@ -65,12 +68,9 @@ void updateCombat(entt::registry& registry, float dt, float gameTime) {
 				}
 
 
-				auto questView = registry.view<QuestGiver>();
-				for (auto questEntity : questView) {
-					auto& questGiver = questView.get<QuestGiver>(questEntity);
-					if (questGiver.quest.status == QuestStatus::InProgress) {
-						questGiver.quest.enemiesKilled++;
-					}
+				if (auto* tracker = registry.ctx().find<QuestTracker>()) {
+					const auto* kind = registry.try_get<EnemyKind>(enemyEntity);
+					tracker->pushKill(kind ? kind->id : NullStringId);
 				}
 			}
 		}
@@ -97,6 +97,7 @@ void updateCombat(entt::registry& registry, float dt, float gameTime) {
 			auto damageNum = registry.create();
 			registry.emplace<Position>(damageNum, playerPos.x, playerPos.y);
 			registry.emplace<DamageNumber>(damageNum, enemyCombat.damage, 1.0f, 0.0f, 0.0f, false);
+			startDamageFlash(registry, playerEntity);
 
 			LOG_DEBUG("Enemy dealt {} damage to player", enemyCombat.damage);
 
@@ -164,8 +165,8 @@ void updateAI(entt::registry& registry, float dt) {
 			case AIState::Patrol: {
 
 				if (!ai.hasPatrolPoint) {
-					ai.patrolX = pos.x + (rand() % 200 - 100);
-					ai.patrolY = pos.y + (rand() % 200 - 100);
+					ai.patrolX = pos.x + static_cast<float>(Random::game().range(-100, 99));
+					ai.patrolY = pos.y + static_cast<float>(Random::game().range(-100, 99));
 					ai.hasPatrolPoint = true;
 				}
 
@@ -259,9 +260,26 @@ void updateItemCollection(entt::registry& registry) {
 
 		float dist = distance(playerPos.x, playerPos.y, itemPos.x, itemPos.y);
 		if (dist <= 32.0f) {
+			const ItemStack stack = droppedItem.stack;
+			const ItemDefinition* def = ItemDatabase::get(stack.id);
+			if (!def) {
+				LOG_WARN("Dropped item has unknown item id {}", stack.id);
+				registry.destroy(itemEntity);
+				continue;
+			}
+
+			bool added = true;
+			if (def->type == ItemType::Coin) {
+				playerInv.gold += def->value * stack.count;
+			} else {
+				added = playerInv.addItem(stack.id, stack.count, def->maxStack);
+			}
 
-			if (playerInv.addItem(droppedItem.item)) {
-				LOG_INFO("Collected: {}", droppedItem.item.name);
+			if (added) {
+				LOG_INFO("Collected: {}", def->name);
+				if (auto* tracker = registry.ctx().find<QuestTracker>()) {
+					tracker->pushPickup(def->key, stack.count);
+				}
 				droppedItem.collected = true;
 				registry.destroy(itemEntity);
 			} else {
@@ -274,28 +292,35 @@ void updateItemCollection(entt::registry& registry) {
 
 
 void updateQuests(entt::registry& registry) {
-	auto questView = registry.view<QuestGiver>();
-	for (auto entity : questView) {
-		auto& questGiver = questView.get<QuestGiver>(entity);
-
-		if (questGiver.quest.status == QuestStatus::InProgress) {
-			if (questGiver.quest.isComplete() && !questGiver.questCompleted) {
-				questGiver.quest.status = QuestStatus::Completed;
-				questGiver.questCompleted = true;
-				LOG_INFO("Quest completed: {}", questGiver.quest.title);
-
-
-				auto playerView = registry.view<Player, Experience, Inventory>();
-				if (playerView.size_hint() != 0) {
-					auto playerEntity = playerView.front();
-					auto& playerXP = playerView.get<Experience>(playerEntity);
-					auto& playerInv = playerView.get<Inventory>(playerEntity);
-
-					playerXP.addXP(questGiver.quest.xpReward);
-					playerInv.gold += questGiver.quest.goldReward;
-					LOG_INFO("Rewards: +{} XP, +{} Gold", questGiver.quest.xpReward, questGiver.quest.goldReward);
+	auto* tracker = registry.ctx().find<QuestTracker>();
+	if (!tracker) return;
+
+	std::vector<entt::entity> completed;
+	tracker->update(registry, completed);
+
+	for (auto entity : completed) {
+		auto& questGiver = registry.get<QuestGiver>(entity);
+		if (questGiver.questCompleted) continue;
+
+		questGiver.quest.status = QuestStatus::Completed;
+		questGiver.questCompleted = true;
+		LOG_INFO("Quest completed: {}", StringPool::lookup(questGiver.quest.title));
+
+
+		auto playerView = registry.view<Player, Experience, Inventory>();
+		if (playerView.size_hint() != 0) {
+			auto playerEntity = playerView.front();
+			auto& playerXP = playerView.get<Experience>(playerEntity);
+			auto& playerInv = playerView.get<Inventory>(playerEntity);
+
+			playerXP.addXP(questGiver.quest.xpReward);
+			playerInv.gold += questGiver.quest.goldReward;
+			for (const auto& reward : questGiver.quest.getItemRewards()) {
+				if (const auto* def = ItemDatabase::get(reward.id)) {
+					playerInv.addItem(reward.id, reward.count, def->maxStack);
 				}
 			}
+			LOG_INFO("Rewards: +{} XP, +{} Gold", questGiver.quest.xpReward, questGiver.quest.goldReward);
 		}
 	}
 }
@@ -315,6 +340,47 @@ void updateDamageNumbers(entt::registry& registry, float dt) {
 	}
 }
 
+void startDamageFlash(entt::registry& registry, entt::entity entity, float duration) {
+	auto* sprite = registry.try_get<Sprite>(entity);
+	if (!sprite) return;
+
+	if (auto* flash = registry.try_get<DamageFlash>(entity)) {
+		flash->elapsed = 0.0f;
+		flash->duration = duration;
+		return;
+	}
+
+	DamageFlash flash;
+	flash.duration = duration;
+	flash.baseR = sprite->tintR;
+	flash.baseG = sprite->tintG;
+	flash.baseB = sprite->tintB;
+	registry.emplace<DamageFlash>(entity, flash);
+}
+
+void updateDamageFlashes(entt::registry& registry, float dt) {
+	auto view = registry.view<DamageFlash, Sprite>();
+	for (auto entity : view) {
+		auto& flash = view.get<DamageFlash>(entity);
+		auto& sprite = view.get<Sprite>(entity);
+		flash.elapsed += dt;
+
+		if (flash.elapsed >= flash.duration) {
+			sprite.tintR = flash.baseR;
+			sprite.tintG = flash.baseG;
+			sprite.tintB = flash.baseB;
+			registry.remove<DamageFlash>(entity);
+			continue;
+		}
+
+		// Fades from the flash colour back to the original tint
+		float strength = 1.0f - flash.elapsed / flash.duration;
+		sprite.tintR = flash.baseR + (flash.r - flash.baseR) * strength;
+		sprite.tintG = flash.baseG + (flash.g - flash.baseG) * strength;
+		sprite.tintB = flash.baseB + (flash.b - flash.baseB) * strength;
+	}
+}
+
 void renderDamageNumbers(entt::registry& registry, SpriteBatch& batch, Font& font, Camera& camera) {
 	auto view = registry.view<DamageNumber, Position>();
 	for (auto entity : view) {
@@ -405,7 +471,7 @@ void renderPlayerUI(entt::registry& registry, SpriteBatch& batch, Font& font, in
 	}
 
 
-	std::string itemText = "Items: " + std::to_string(inv.items.size()) + "/" + std::to_string(inv.maxSlots);
+	std::string itemText = "Items: " + std::to_string(inv.size()) + "/" + std::to_string(inv.maxSlots);
 	auto itemTexture = font.renderText(itemText, {200, 200, 200, 255});
 	if (itemTexture) {
 		batch.draw(*itemTexture, 10, y);
@@ -39,6 +39,11 @@ RUNA_API void updateQuests(entt::registry &registry);
 
 
 RUNA_API void updateDamageNumbers(entt::registry &registry, float dt);
+
+// Flash an entity's Sprite tint; restarting an active flash keeps its original tint
+RUNA_API void startDamageFlash(entt::registry &registry, entt::entity entity,
+                               float duration = 0.2f);
+RUNA_API void updateDamageFlashes(entt::registry &registry, float dt);
 RUNA_API void renderDamageNumbers(entt::registry &registry, SpriteBatch &batch,
                                   Font &font, Camera &camera);
 
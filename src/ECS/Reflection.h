@@ -0,0 +1,385 @@
+// File: src/ECS/Reflection.h
+
+/**
+ * Reflection.h
+ * Compile-time component reflection. Each reflected component has a
+ * ComponentInfo specialization listing its fields (name, type, offset, size);
+ * serialization and the inspector walk these tables instead of hand-written
+ * per-component code. The tables only cover fields worth showing or saving as
+ * text, so they are not a complete description of a component's bytes.
+ */
+
+#ifndef RUNA_ECS_REFLECTION_H
+#define RUNA_ECS_REFLECTION_H
+
+#include "Components.h"
+#include "RPGComponents.h"
+#include <entt/entt.hpp>
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace Runa::ECS {
+
+    enum class FieldType : uint8_t {
+        Float,
+        Int,
+        UInt32,
+        Bool,
+        String,     // StringId, resolved through StringPool
+        Enum        // Integral enum, stored as its underlying integer
+    };
+
+    struct FieldInfo {
+        const char* name;
+        FieldType type;
+        uint32_t offset;
+        uint32_t size;
+    };
+
+    namespace detail {
+        template<typename Member>
+        constexpr FieldType fieldTypeOf() {
+            if constexpr (std::is_enum_v<Member>) {
+                return FieldType::Enum;
+            } else if constexpr (std::is_same_v<Member, float>) {
+                return FieldType::Float;
+            } else if constexpr (std::is_same_v<Member, int>) {
+                return FieldType::Int;
+            } else if constexpr (std::is_same_v<Member, uint32_t>) {
+                return FieldType::UInt32;
+            } else if constexpr (std::is_same_v<Member, bool>) {
+                return FieldType::Bool;
+            } else {
+                static_assert(!sizeof(Member), "Unsupported reflected field type");
+            }
+        }
+    }
+
+// Field whose type is deduced from the member declaration
+#define RUNA_REFLECT_FIELD(Type, member) \
+    ::Runa::ECS::FieldInfo{#member, ::Runa::ECS::detail::fieldTypeOf<decltype(Type::member)>(), \
+                           static_cast<uint32_t>(offsetof(Type, member)), static_cast<uint32_t>(sizeof(Type::member))}
+
+// StringId field (StringId is a plain uint32_t, so it has to be marked explicitly)
+#define RUNA_REFLECT_STRING(Type, member) \
+    ::Runa::ECS::FieldInfo{#member, ::Runa::ECS::FieldType::String, \
+                           static_cast<uint32_t>(offsetof(Type, member)), static_cast<uint32_t>(sizeof(StringId))}
+
+    /**
+     * ComponentInfo - Reflection descriptor, specialized per component:
+     *   static constexpr const char* name;
+     *   static constexpr std::array<FieldInfo, N> fields;   (empty for tags)
+     * Members left out of `fields` (e.g. Sprite::spriteSheet) are not serialized,
+     * diffed or shown.
+     */
+    template<typename Component>
+    struct ComponentInfo;
+
+    template<typename Component>
+    concept Reflected = requires {
+        { ComponentInfo<Component>::name } -> std::convertible_to<const char*>;
+        ComponentInfo<Component>::fields;
+    };
+
+    template<>
+    struct ComponentInfo<Position> {
+        static constexpr const char* name = "Position";
+        static constexpr std::array fields{
+            RUNA_REFLECT_FIELD(Position, x),
+            RUNA_REFLECT_FIELD(Position, y)
+        };
+    };
+
+    template<>
+    struct ComponentInfo<Velocity> {
+        static constexpr const char* name = "Velocity";
+        static constexpr std::array fields{
+            RUNA_REFLECT_FIELD(Velocity, x),
+            RUNA_REFLECT_FIELD(Velocity, y)
+        };
+    };
+
+    template<>
+    struct ComponentInfo<Size> {
+        static constexpr const char* name = "Size";
+        static constexpr std::array fields{
+            RUNA_REFLECT_FIELD(Size, width),
+            RUNA_REFLECT_FIELD(Size, height)
+        };
+    };
+
+    template<>
+    struct ComponentInfo<Sprite> {
+        static constexpr const char* name = "Sprite";
+        static constexpr std::array fields{
+            RUNA_REFLECT_STRING(Sprite, spriteName),
+            RUNA_REFLECT_FIELD(Sprite, tintR),
+            RUNA_REFLECT_FIELD(Sprite, tintG),
+            RUNA_REFLECT_FIELD(Sprite, tintB),
+            RUNA_REFLECT_FIELD(Sprite, tintA),
+            RUNA_REFLECT_FIELD(Sprite, flipX),
+            RUNA_REFLECT_FIELD(Sprite, flipY)
+        };
+    };
+
+    template<>
+    struct ComponentInfo<Animation> {
+        static constexpr const char* name = "Animation";
+        static constexpr std::array fields{
+            RUNA_REFLECT_FIELD(Animation, currentFrame),
+            RUNA_REFLECT_FIELD(Animation, animationTime),
+            RUNA_REFLECT_FIELD(Animation, frameRate),
+            RUNA_REFLECT_FIELD(Animation, loop)
+        };
+    };
+
+    template<>
+    struct ComponentInfo<PlayerInput> {
+        static constexpr const char* name = "PlayerInput";
+        static constexpr std::array fields{
+            RUNA_REFLECT_FIELD(PlayerInput, speed)
+        };
+    };
+
+    template<>
+    struct ComponentInfo<AABB> {
+        static constexpr const char* name = "AABB";
+        static constexpr std::array fields{
+            RUNA_REFLECT_FIELD(AABB, offsetX),
+            RUNA_REFLECT_FIELD(AABB, offsetY),
+            RUNA_REFLECT_FIELD(AABB, width),
+            RUNA_REFLECT_FIELD(AABB, height)
+        };
+    };
+
+    template<>
+    struct ComponentInfo<Player> {
+        static constexpr const char* name = "Player";
+        static constexpr std::array<FieldInfo, 0> fields{};
+    };
+
+    template<>
+    struct ComponentInfo<CameraTarget> {
+        static constexpr const char* name = "CameraTarget";
+        static constexpr std::array fields{
+            RUNA_REFLECT_FIELD(CameraTarget, smoothing)
+        };
+    };
+
+    template<>
+    struct ComponentInfo<CollisionLayer> {
+        static constexpr const char* name = "CollisionLayer";
+        static constexpr std::array fields{
+            RUNA_REFLECT_FIELD(CollisionLayer, layer),
+            RUNA_REFLECT_FIELD(CollisionLayer, mask)
+        };
+    };
+
+    template<>
+    struct ComponentInfo<Collider> {
+        static constexpr const char* name = "Collider";
+        static constexpr std::array fields{
+            RUNA_REFLECT_FIELD(Collider, type),
+            RUNA_REFLECT_FIELD(Collider, enabled),
+            RUNA_REFLECT_FIELD(Collider, isTrigger),
+            RUNA_REFLECT_FIELD(Collider, blocksMovement),
+            RUNA_REFLECT_FIELD(Collider, detectsOverlap)
+        };
+    };
+
+    template<>
+    struct ComponentInfo<Interactable> {
+        static constexpr const char* name = "Interactable";
+        static constexpr std::array fields{
+            RUNA_REFLECT_FIELD(Interactable, type),
+            RUNA_REFLECT_STRING(Interactable, data),
+            RUNA_REFLECT_STRING(Interactable, targetScene),
+            RUNA_REFLECT_FIELD(Interactable, targetX),
+            RUNA_REFLECT_FIELD(Interactable, targetY),
+            RUNA_REFLECT_FIELD(Interactable, interactionRange),
+            RUNA_REFLECT_FIELD(Interactable, oneTime),
+            RUNA_REFLECT_FIELD(Interactable, consumed),
+            RUNA_REFLECT_FIELD(Interactable, requiresFacing)
+        };
+    };
+
+    template<>
+    struct ComponentInfo<CanInteract> {
+        static constexpr const char* name = "CanInteract";
+        static constexpr std::array fields{
+            RUNA_REFLECT_FIELD(CanInteract, range),
+            RUNA_REFLECT_FIELD(CanInteract, isInteracting)
+        };
+    };
+
+    template<>
+    struct ComponentInfo<Health> {
+        static constexpr const char* name = "Health";
+        static constexpr std::array fields{
+            RUNA_REFLECT_FIELD(Health, current),
+            RUNA_REFLECT_FIELD(Health, max),
+            RUNA_REFLECT_FIELD(Health, isDead)
+        };
+    };
+
+    template<>
+    struct ComponentInfo<Combat> {
+        static constexpr const char* name = "Combat";
+        static constexpr std::array fields{
+            RUNA_REFLECT_FIELD(Combat, damage),
+            RUNA_REFLECT_FIELD(Combat, attackRange),
+            RUNA_REFLECT_FIELD(Combat, attackCooldown),
+            RUNA_REFLECT_FIELD(Combat, lastAttackTime)
+        };
+    };
+
+    template<>
+    struct ComponentInfo<Experience> {
+        static constexpr const char* name = "Experience";
+        static constexpr std::array fields{
+            RUNA_REFLECT_FIELD(Experience, currentXP),
+            RUNA_REFLECT_FIELD(Experience, level),
+            RUNA_REFLECT_FIELD(Experience, xpToNextLevel)
+        };
+    };
+
+    template<>
+    struct ComponentInfo<AIController> {
+        static constexpr const char* name = "AIController";
+        static constexpr std::array fields{
+            RUNA_REFLECT_FIELD(AIController, state),
+            RUNA_REFLECT_FIELD(AIController, detectionRange),
+            RUNA_REFLECT_FIELD(AIController, attackRange),
+            RUNA_REFLECT_FIELD(AIController, moveSpeed),
+            RUNA_REFLECT_FIELD(AIController, chaseTime),
+            RUNA_REFLECT_FIELD(AIController, idleTime),
+            RUNA_REFLECT_FIELD(AIController, patrolX),
+            RUNA_REFLECT_FIELD(AIController, patrolY),
+            RUNA_REFLECT_FIELD(AIController, patrolRadius),
+            RUNA_REFLECT_FIELD(AIController, hasPatrolPoint)
+        };
+    };
+
+    template<>
+    struct ComponentInfo<EnemyKind> {
+        static constexpr const char* name = "EnemyKind";
+        static constexpr std::array fields{
+            RUNA_REFLECT_STRING(EnemyKind, id)
+        };
+    };
+
+    template<>
+    struct ComponentInfo<Enemy> {
+        static constexpr const char* name = "Enemy";
+        static constexpr std::array<FieldInfo, 0> fields{};
+    };
+
+    template<>
+    struct ComponentInfo<NPC> {
+        static constexpr const char* name = "NPC";
+        static constexpr std::array<FieldInfo, 0> fields{};
+    };
+
+    template<>
+    struct ComponentInfo<ItemEntity> {
+        static constexpr const char* name = "ItemEntity";
+        static constexpr std::array<FieldInfo, 0> fields{};
+    };
+
+    template<>
+    struct ComponentInfo<Static> {
+        static constexpr const char* name = "Static";
+        static constexpr std::array<FieldInfo, 0> fields{};
+    };
+
+    template<>
+    struct ComponentInfo<Pickup> {
+        static constexpr const char* name = "Pickup";
+        static constexpr std::array<FieldInfo, 0> fields{};
+    };
+
+    template<>
+    struct ComponentInfo<Projectile> {
+        static constexpr const char* name = "Projectile";
+        static constexpr std::array<FieldInfo, 0> fields{};
+    };
+
+    // Components written to YAML scene files, in file order
+    using SerializedComponents = entt::type_list<
+        Position, Velocity, Size, Sprite, Animation, PlayerInput, AABB, Player, CameraTarget>;
+
+    // Every reflected component (serialized ones first)
+    using ReflectedComponents = entt::type_list_cat_t<SerializedComponents, entt::type_list<
+        CollisionLayer, Collider, Interactable, CanInteract,
+        Health, Combat, Experience, AIController, EnemyKind,
+        Enemy, NPC, ItemEntity, Static, Pickup, Projectile>>;
+
+    /**
+     * ComponentDescriptor - Runtime view of a ComponentInfo, for code that
+     * looks components up by name (e.g. generic deserialization).
+     */
+    struct ComponentDescriptor {
+        const char* name;
+        std::span<const FieldInfo> fields;
+        entt::id_type typeId;
+    };
+
+    namespace detail {
+        template<typename Func, typename... Types, size_t... Index>
+        void forEachReflectedImpl(Func& func, entt::type_list<Types...>, std::index_sequence<Index...>) {
+            (func.template operator()<Types>(static_cast<uint32_t>(Index)), ...);
+        }
+
+        template<typename... Types>
+        auto makeDescriptors(entt::type_list<Types...>) {
+            return std::array<ComponentDescriptor, sizeof...(Types)>{
+                ComponentDescriptor{ComponentInfo<Types>::name, ComponentInfo<Types>::fields,
+                                    entt::type_hash<Types>::value()}...
+            };
+        }
+    }
+
+    // Calls func.template operator()<Component>(index) for each component in List
+    template<typename List = ReflectedComponents, typename Func>
+    void forEachReflected(Func&& func) {
+        detail::forEachReflectedImpl(func, List{}, std::make_index_sequence<List::size>{});
+    }
+
+    // Descriptors for ReflectedComponents, in list order
+    inline std::span<const ComponentDescriptor> getComponentDescriptors() {
+        static const auto descriptors = detail::makeDescriptors(ReflectedComponents{});
+        return descriptors;
+    }
+
+    inline const ComponentDescriptor* findComponentDescriptor(std::string_view name) {
+        for (const auto& descriptor : getComponentDescriptors()) {
+            if (name == descriptor.name) {
+                return &descriptor;
+            }
+        }
+        return nullptr;
+    }
+
+    template<typename T>
+    T readField(const void* component, const FieldInfo& field) {
+        T value{};
+        std::memcpy(&value, static_cast<const std::byte*>(component) + field.offset, std::min<size_t>(sizeof(T), field.size));
+        return value;
+    }
+
+    template<typename T>
+    void writeField(void* component, const FieldInfo& field, T value) {
+        std::memcpy(static_cast<std::byte*>(component) + field.offset, &value, std::min<size_t>(sizeof(T), field.size));
+    }
+
+}
+
+#endif // RUNA_ECS_REFLECTION_H
@@ -3,10 +3,16 @@
 #include "../runapch.h"
 #include "Registry.h"
 #include "RPGComponents.h"
+#include "Systems.h"
 #include "../Graphics/SpriteSheet.h"
 
 namespace Runa::ECS {
 
+EntityRegistry::EntityRegistry() {
+    // New positions start without interpolation history, whichever way they were created
+    m_registry.on_construct<Position>().connect<&Systems::snapPreviousPosition>();
+}
+
 entt::entity EntityRegistry::createEntity(float x, float y) {
     auto entity = m_registry.create();
     m_registry.emplace<Position>(entity, x, y);
@@ -24,7 +30,7 @@ entt::entity EntityRegistry::createSpriteEntity(float x, float y,
 
     Sprite sprite;
     sprite.spriteSheet = spriteSheet;
-    sprite.spriteName = spriteName;
+    sprite.spriteName = StringPool::intern(spriteName);
     m_registry.emplace<Sprite>(entity, sprite);
 
     m_registry.emplace<Animation>(entity);
@@ -70,7 +76,7 @@ void EntityRegistry::addSprite(entt::entity entity, const SpriteSheet* spriteShe
 
     Sprite sprite;
     sprite.spriteSheet = spriteSheet;
-    sprite.spriteName = spriteName;
+    sprite.spriteName = StringPool::intern(spriteName);
     m_registry.emplace_or_replace<Sprite>(entity, sprite);
 }
 
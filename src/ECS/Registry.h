@@ -17,7 +17,7 @@ namespace Runa::ECS {
 
 class RUNA_API EntityRegistry {
 public:
-    EntityRegistry() = default;
+    EntityRegistry();
     ~EntityRegistry() = default;
 
 
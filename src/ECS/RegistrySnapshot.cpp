@@ -0,0 +1,621 @@
+// File: src/ECS/RegistrySnapshot.cpp
+
+/**
+ * RegistrySnapshot.cpp
+ * Snapshot layout, capture/restore through entt::snapshot, delta encoding
+ * and the rewind ring buffer.
+ *
+ * Layout:
+ *   SnapshotHeader
+ *   uint64 offsets[sectionCount + 1]      section i spans [offsets[i], offsets[i + 1])
+ *   section 0: entities     uint32 count, uint32 freeList, entity[count]
+ *   section 1..N, full:     uint32 count, (entity, value)[count]       (tags: entity only)
+ *   section 1..N, delta:    uint32 removed, entity[removed],
+ *                           uint32 changed, (entity, value)[changed]
+ */
+
+#include "../runapch.h"
+#include "RegistrySnapshot.h"
+#include "Components.h"
+#include "RPGComponents.h"
+#include "QuestTracker.h"
+#include "../Core/Log.h"
+#include <cstring>
+#include <type_traits>
+#include <unordered_map>
+
+namespace Runa::ECS {
+
+    namespace {
+
+        // Captured component types. Append new types at the end; the layout hash
+        // changes with the list, so older snapshots are rejected rather than misread.
+        using SnapshotComponents = entt::type_list<
+            Position, Velocity, Size, Sprite, Animation, AABB, CollisionLayer, Collider,
+            Interactable, CanInteract, PlayerInput, CameraTarget,
+            Active, Projectile, Pickup, Static,
+            Health, Combat, Experience, AIController, DroppedItem, Inventory, DamageNumber,
+            EnemyKind, Player, Enemy, NPC, ItemEntity, DamageFlash,
+            Transform, QuestGiver>;
+
+        constexpr uint32_t SectionCount = SnapshotComponents::size + 1;
+
+        constexpr uint32_t SnapshotMagic = 0x504E5352;  // "RSNP"
+        constexpr uint16_t SnapshotVersion = 1;
+        constexpr uint16_t FlagDelta = 1u << 0;
+
+        struct SnapshotHeader {
+            uint32_t magic = SnapshotMagic;
+            uint16_t version = SnapshotVersion;
+            uint16_t flags = 0;
+            uint32_t sectionCount = SectionCount;
+            uint32_t reserved = 0;
+            uint64_t layoutHash = 0;
+        };
+
+        constexpr size_t OffsetTableStart = sizeof(SnapshotHeader);
+        constexpr size_t DataStart = OffsetTableStart + (SectionCount + 1) * sizeof(uint64_t);
+
+        template<typename Func, typename... Types, size_t... Index>
+        void forEachComponentImpl(Func& func, entt::type_list<Types...>, std::index_sequence<Index...>) {
+            (func.template operator()<Types>(static_cast<uint32_t>(Index)), ...);
+        }
+
+        // Calls func.template operator()<Component>(componentIndex) for each snapshot component
+        template<typename Func>
+        void forEachComponent(Func&& func) {
+            forEachComponentImpl(func, SnapshotComponents{}, std::make_index_sequence<SnapshotComponents::size>{});
+        }
+
+        template<typename Type>
+        constexpr bool isTag = std::is_empty_v<Type>;
+
+        template<typename Type>
+        constexpr size_t entryStride = sizeof(entt::entity) + (isTag<Type> ? 0 : sizeof(Type));
+
+        uint64_t computeLayoutHash() {
+            // FNV-1a over each component's type hash and size
+            uint64_t hash = 14695981039346656037ull;
+            auto mix = [&hash](uint64_t value) {
+                for (int i = 0; i < 8; ++i) {
+                    hash ^= (value >> (i * 8)) & 0xFF;
+                    hash *= 1099511628211ull;
+                }
+            };
+
+            mix(sizeof(entt::entity));
+            forEachComponent([&]<typename Type>(uint32_t) {
+                static_assert(std::is_trivially_copyable_v<Type>, "Snapshot components must be trivially copyable");
+                mix(entt::type_hash<Type>::value());
+                mix(isTag<Type> ? 0 : sizeof(Type));
+            });
+            return hash;
+        }
+
+        uint64_t layoutHash() {
+            static const uint64_t hash = computeLayoutHash();
+            return hash;
+        }
+
+        template<typename T>
+        T readAt(const std::byte* data) {
+            T value;
+            std::memcpy(&value, data, sizeof(T));
+            return value;
+        }
+
+        /**
+         * Output archive for entt::snapshot: appends raw values to the arena.
+         */
+        class ArenaWriter {
+        public:
+            explicit ArenaWriter(SnapshotArena& arena) : m_arena(arena) {}
+
+            template<typename T>
+            void operator()(const T& value) {
+                static_assert(std::is_trivially_copyable_v<T>);
+                std::memcpy(m_arena.append(sizeof(T)), &value, sizeof(T));
+            }
+
+            // Reserve a uint32 to be filled in later with patch()
+            size_t reserveCount() {
+                size_t offset = m_arena.size();
+                m_arena.append(sizeof(uint32_t));
+                return offset;
+            }
+
+            void patch(size_t offset, uint32_t value) {
+                std::memcpy(m_arena.data() + offset, &value, sizeof(value));
+            }
+
+        private:
+            SnapshotArena& m_arena;
+        };
+
+        /**
+         * Input archive for entt::snapshot_loader. Sections are validated before
+         * loading, so reads are not bounds-checked here.
+         */
+        class ArenaReader {
+        public:
+            explicit ArenaReader(const std::byte* data) : m_cursor(data) {}
+
+            template<typename T>
+            void operator()(T& value) {
+                static_assert(std::is_trivially_copyable_v<T>);
+                std::memcpy(&value, m_cursor, sizeof(T));
+                m_cursor += sizeof(T);
+            }
+
+        private:
+            const std::byte* m_cursor;
+        };
+
+        bool validEntitySection(const std::byte* data, size_t size) {
+            if (size < 2 * sizeof(uint32_t)) return false;
+            uint64_t count = readAt<uint32_t>(data);
+            uint64_t inUse = readAt<uint32_t>(data + sizeof(uint32_t));
+            return inUse <= count && size == 2 * sizeof(uint32_t) + count * sizeof(entt::entity);
+        }
+
+        template<typename Type>
+        bool validFullSection(const std::byte* data, size_t size) {
+            if (size < sizeof(uint32_t)) return false;
+            uint64_t count = readAt<uint32_t>(data);
+            return size == sizeof(uint32_t) + count * entryStride<Type>;
+        }
+
+        template<typename Type>
+        bool validDeltaSection(const std::byte* data, size_t size) {
+            if (size < 2 * sizeof(uint32_t)) return false;
+            uint64_t removed = readAt<uint32_t>(data);
+            size_t changedAt = sizeof(uint32_t) + removed * sizeof(entt::entity);
+            if (changedAt + sizeof(uint32_t) > size) return false;
+            uint64_t changed = readAt<uint32_t>(data + changedAt);
+            return size == changedAt + sizeof(uint32_t) + changed * entryStride<Type>;
+        }
+
+        // Compares the whole stored value, including fields the reflection tables leave
+        // out (Sprite::spriteSheet, Position::prevX/prevY). Differing padding bytes only
+        // cost a redundant entry in the delta.
+        template<typename Type>
+        bool sameValue(const std::byte* stored, const Type& value) {
+            return std::memcmp(stored, &value, sizeof(Type)) == 0;
+        }
+
+        template<typename Type>
+        void writeComponentDelta(const entt::registry& registry, const std::byte* base, ArenaWriter& out) {
+            constexpr size_t stride = entryStride<Type>;
+            const uint32_t baseCount = readAt<uint32_t>(base);
+            const std::byte* baseEntries = base + sizeof(uint32_t);
+            auto baseEntity = [&](size_t index) { return readAt<entt::entity>(baseEntries + index * stride); };
+
+            const auto* storage = registry.storage<Type>();
+
+            // Removed since the base
+            size_t removedAt = out.reserveCount();
+            uint32_t removed = 0;
+            for (uint32_t i = 0; i < baseCount; ++i) {
+                entt::entity entity = baseEntity(i);
+                if (!storage || !storage->contains(entity)) {
+                    out(entity);
+                    removed++;
+                }
+            }
+            out.patch(removedAt, removed);
+
+            // Added or changed. Storage order usually matches the base, so compare
+            // by position first and only build an index once the orders diverge.
+            size_t changedAt = out.reserveCount();
+            uint32_t changed = 0;
+            if (storage) {
+                std::unordered_map<entt::entity, uint32_t> baseIndex;
+                uint32_t position = 0;
+
+                for (auto elem : storage->reach()) {
+                    entt::entity entity = std::get<0>(elem);
+
+                    const std::byte* baseEntry = nullptr;
+                    if (position < baseCount && baseEntity(position) == entity) {
+                        baseEntry = baseEntries + position * stride;
+                    } else {
+                        if (baseIndex.empty() && baseCount > 0) {
+                            baseIndex.reserve(baseCount);
+                            for (uint32_t i = 0; i < baseCount; ++i) {
+                                baseIndex.emplace(baseEntity(i), i);
+                            }
+                        }
+                        if (auto it = baseIndex.find(entity); it != baseIndex.end()) {
+                            baseEntry = baseEntries + it->second * stride;
+                        }
+                    }
+                    position++;
+
+                    if constexpr (isTag<Type>) {
+                        if (!baseEntry) {
+                            out(entity);
+                            changed++;
+                        }
+                    } else {
+                        const Type& value = std::get<1>(elem);
+                        if (!baseEntry || !sameValue(baseEntry + sizeof(entt::entity), value)) {
+                            out(entity);
+                            out(value);
+                            changed++;
+                        }
+                    }
+                }
+            }
+            out.patch(changedAt, changed);
+        }
+
+        template<typename Type>
+        void emplaceOrAssign(entt::registry& registry, entt::entity entity, const std::byte* value) {
+            auto& storage = registry.storage<Type>();
+            if constexpr (isTag<Type>) {
+                if (!storage.contains(entity)) {
+                    storage.emplace(entity);
+                }
+            } else {
+                Type component = readAt<Type>(value);
+                if (storage.contains(entity)) {
+                    storage.get(entity) = component;
+                } else {
+                    storage.emplace(entity, component);
+                }
+            }
+        }
+
+        // Base entries for entities that no longer exist are skipped; the delta's removals cover them
+        template<typename Type>
+        void applyComponentBase(entt::registry& registry, const std::byte* base) {
+            constexpr size_t stride = entryStride<Type>;
+            const uint32_t count = readAt<uint32_t>(base);
+            const std::byte* entries = base + sizeof(uint32_t);
+
+            for (uint32_t i = 0; i < count; ++i) {
+                const std::byte* entry = entries + i * stride;
+                entt::entity entity = readAt<entt::entity>(entry);
+                if (registry.valid(entity)) {
+                    emplaceOrAssign<Type>(registry, entity, entry + sizeof(entt::entity));
+                }
+            }
+        }
+
+        template<typename Type>
+        void applyComponentDelta(entt::registry& registry, const std::byte* delta) {
+            auto& storage = registry.storage<Type>();
+
+            const uint32_t removed = readAt<uint32_t>(delta);
+            const std::byte* cursor = delta + sizeof(uint32_t);
+            for (uint32_t i = 0; i < removed; ++i, cursor += sizeof(entt::entity)) {
+                storage.remove(readAt<entt::entity>(cursor));
+            }
+
+            const uint32_t changed = readAt<uint32_t>(cursor);
+            cursor += sizeof(uint32_t);
+            for (uint32_t i = 0; i < changed; ++i, cursor += entryStride<Type>) {
+                entt::entity entity = readAt<entt::entity>(cursor);
+                if (registry.valid(entity)) {
+                    emplaceOrAssign<Type>(registry, entity, cursor + sizeof(entt::entity));
+                }
+            }
+        }
+
+        // snapshot_loader expects every storage, including the entity storage, to be empty
+        void resetRegistry(entt::registry& registry) {
+            registry.clear();
+            registry.storage<entt::entity>().clear();
+        }
+    }
+
+    // ========================================================================
+    // SnapshotArena
+    // ========================================================================
+
+    void SnapshotArena::reserve(size_t bytes) {
+        if (bytes <= m_capacity) {
+            return;
+        }
+
+        auto data = std::make_unique_for_overwrite<std::byte[]>(bytes);
+        if (m_size > 0) {
+            std::memcpy(data.get(), m_data.get(), m_size);
+        }
+        m_data = std::move(data);
+        m_capacity = bytes;
+    }
+
+    std::byte* SnapshotArena::append(size_t bytes) {
+        if (m_size + bytes > m_capacity) {
+            reserve(std::max(m_size + bytes, m_capacity * 2));
+        }
+        std::byte* ptr = m_data.get() + m_size;
+        m_size += bytes;
+        return ptr;
+    }
+
+    void SnapshotArena::assign(const std::byte* data, size_t bytes) {
+        m_size = 0;
+        reserve(bytes);
+        if (bytes > 0) {
+            std::memcpy(m_data.get(), data, bytes);
+        }
+        m_size = bytes;
+    }
+
+    // ========================================================================
+    // RegistrySnapshot
+    // ========================================================================
+
+    void RegistrySnapshot::beginSections(uint16_t flags) {
+        m_arena.clear();
+
+        SnapshotHeader header;
+        header.flags = flags;
+        header.layoutHash = layoutHash();
+        std::memcpy(m_arena.append(sizeof(header)), &header, sizeof(header));
+        std::memset(m_arena.append((SectionCount + 1) * sizeof(uint64_t)), 0, (SectionCount + 1) * sizeof(uint64_t));
+    }
+
+    void RegistrySnapshot::markSection(uint32_t index) {
+        uint64_t offset = m_arena.size();
+        std::memcpy(m_arena.data() + OffsetTableStart + index * sizeof(uint64_t), &offset, sizeof(offset));
+    }
+
+    void RegistrySnapshot::endSections() {
+        markSection(SectionCount);
+    }
+
+    RegistrySnapshot::Section RegistrySnapshot::section(uint32_t index) const {
+        const std::byte* table = m_arena.data() + OffsetTableStart;
+        uint64_t begin = readAt<uint64_t>(table + index * sizeof(uint64_t));
+        uint64_t end = readAt<uint64_t>(table + (index + 1) * sizeof(uint64_t));
+        return {m_arena.data() + begin, static_cast<size_t>(end - begin)};
+    }
+
+    void RegistrySnapshot::capture(const entt::registry& registry) {
+        beginSections(0);
+
+        ArenaWriter out(m_arena);
+        entt::snapshot snapshot{registry};
+
+        markSection(0);
+        snapshot.get<entt::entity>(out);
+
+        forEachComponent([&]<typename Type>(uint32_t index) {
+            markSection(index + 1);
+            snapshot.get<Type>(out);
+        });
+
+        endSections();
+    }
+
+    bool RegistrySnapshot::captureDelta(const entt::registry& registry, const RegistrySnapshot& base) {
+        if (&base == this || !base.isValid() || base.isDelta()) {
+            LOG_ERROR("RegistrySnapshot: Delta capture needs a valid full base snapshot");
+            return false;
+        }
+
+        beginSections(FlagDelta);
+
+        ArenaWriter out(m_arena);
+        entt::snapshot snapshot{registry};
+
+        markSection(0);
+        snapshot.get<entt::entity>(out);
+
+        forEachComponent([&]<typename Type>(uint32_t index) {
+            markSection(index + 1);
+            writeComponentDelta<Type>(registry, base.section(index + 1).data, out);
+        });
+
+        endSections();
+        return true;
+    }
+
+    bool RegistrySnapshot::restore(entt::registry& registry, const RegistrySnapshot* base) const {
+        if (!isValid()) {
+            LOG_ERROR("RegistrySnapshot: Cannot restore an invalid snapshot");
+            return false;
+        }
+
+        const bool delta = isDelta();
+        if (delta && (!base || !base->isValid() || base->isDelta())) {
+            LOG_ERROR("RegistrySnapshot: Delta snapshot restored without its full base");
+            return false;
+        }
+
+        resetRegistry(registry);
+        entt::snapshot_loader loader{registry};
+
+        ArenaReader entities(section(0).data);
+        loader.get<entt::entity>(entities);
+
+        forEachComponent([&]<typename Type>(uint32_t index) {
+            if (delta) {
+                applyComponentBase<Type>(registry, base->section(index + 1).data);
+                applyComponentDelta<Type>(registry, section(index + 1).data);
+            } else {
+                ArenaReader in(section(index + 1).data);
+                loader.get<Type>(in);
+            }
+        });
+
+        // Subscriptions point at objective slots of the QuestGivers that were just replaced
+        if (auto* tracker = registry.ctx().find<QuestTracker>()) {
+            tracker->rebuild(registry);
+        }
+
+        return true;
+    }
+
+    bool RegistrySnapshot::assign(std::span<const std::byte> bytes) {
+        m_arena.assign(bytes.data(), bytes.size());
+        if (!isValid()) {
+            LOG_ERROR("RegistrySnapshot: Rejected {} bytes of snapshot data (corrupt or different component layout)",
+                      bytes.size());
+            m_arena.clear();
+            return false;
+        }
+        return true;
+    }
+
+    bool RegistrySnapshot::isDelta() const {
+        if (m_arena.size() < sizeof(SnapshotHeader)) {
+            return false;
+        }
+        return (readAt<SnapshotHeader>(m_arena.data()).flags & FlagDelta) != 0;
+    }
+
+    bool RegistrySnapshot::isValid() const {
+        if (m_arena.size() < DataStart) {
+            return false;
+        }
+
+        auto header = readAt<SnapshotHeader>(m_arena.data());
+        if (header.magic != SnapshotMagic || header.version != SnapshotVersion ||
+            header.sectionCount != SectionCount || header.layoutHash != layoutHash()) {
+            return false;
+        }
+
+        // Offsets must be increasing and inside the buffer
+        const std::byte* table = m_arena.data() + OffsetTableStart;
+        uint64_t previous = DataStart;
+        for (uint32_t i = 0; i <= SectionCount; ++i) {
+            uint64_t offset = readAt<uint64_t>(table + i * sizeof(uint64_t));
+            if (offset < previous || offset > m_arena.size()) {
+                return false;
+            }
+            previous = offset;
+        }
+        if (previous != m_arena.size()) {
+            return false;
+        }
+
+        Section entities = section(0);
+        if (!validEntitySection(entities.data, entities.size)) {
+            return false;
+        }
+
+        const bool delta = (header.flags & FlagDelta) != 0;
+        bool valid = true;
+        forEachComponent([&]<typename Type>(uint32_t index) {
+            Section current = section(index + 1);
+            valid = valid && (delta ? validDeltaSection<Type>(current.data, current.size)
+                                    : validFullSection<Type>(current.data, current.size));
+        });
+        return valid;
+    }
+
+    size_t RegistrySnapshot::getEntityCount() const {
+        if (!isValid()) {
+            return 0;
+        }
+        // Second field of the entity section is the storage's in-use count
+        return readAt<uint32_t>(section(0).data + sizeof(uint32_t));
+    }
+
+    // ========================================================================
+    // SnapshotHistory
+    // ========================================================================
+
+    SnapshotHistory::SnapshotHistory(size_t capacity, size_t keyframeInterval, size_t reserveBytes)
+        : m_keyframeInterval(std::max<size_t>(keyframeInterval, 1)) {
+        m_slots.reserve(std::max<size_t>(capacity, 1));
+        for (size_t i = 0; i < std::max<size_t>(capacity, 1); ++i) {
+            m_slots.push_back(Slot{RegistrySnapshot(reserveBytes), 0});
+        }
+    }
+
+    size_t SnapshotHistory::slotAt(size_t age) const {
+        return (m_head + m_slots.size() - 1 - age) % m_slots.size();
+    }
+
+    void SnapshotHistory::popOldest() {
+        if (m_count == 0) {
+            return;
+        }
+
+        size_t oldest = slotAt(m_count - 1);
+        m_slots[oldest].snapshot.clear();
+        m_count--;
+
+        if (m_hasKeyframe && oldest == m_keyframe) {
+            m_hasKeyframe = false;
+        }
+
+        // Deltas whose keyframe was evicted can no longer be restored
+        while (m_count > 0 && m_slots[slotAt(m_count - 1)].snapshot.isDelta()) {
+            m_slots[slotAt(m_count - 1)].snapshot.clear();
+            m_count--;
+        }
+    }
+
+    void SnapshotHistory::record(const entt::registry& registry) {
+        // Writing into the oldest slot evicts it (and any deltas that depend on it)
+        if (m_count == m_slots.size()) {
+            popOldest();
+        }
+
+        Slot& slot = m_slots[m_head];
+
+        bool keyframe = !m_hasKeyframe || m_sinceKeyframe + 1 >= m_keyframeInterval;
+        if (keyframe) {
+            slot.snapshot.capture(registry);
+            m_keyframe = m_head;
+            m_hasKeyframe = true;
+            m_sinceKeyframe = 0;
+        } else {
+            slot.snapshot.captureDelta(registry, m_slots[m_keyframe].snapshot);
+            slot.base = m_keyframe;
+            m_sinceKeyframe++;
+        }
+
+        m_head = (m_head + 1) % m_slots.size();
+        m_count++;
+    }
+
+    bool SnapshotHistory::rewind(entt::registry& registry, size_t steps) {
+        if (steps >= m_count) {
+            return false;
+        }
+
+        size_t target = slotAt(steps);
+        const Slot& slot = m_slots[target];
+        const RegistrySnapshot* base = slot.snapshot.isDelta() ? &m_slots[slot.base].snapshot : nullptr;
+        if (!slot.snapshot.restore(registry, base)) {
+            return false;
+        }
+
+        // Drop the newer states; the restored one becomes the newest
+        for (size_t i = 0; i < steps; ++i) {
+            m_slots[slotAt(0)].snapshot.clear();
+            m_head = (m_head + m_slots.size() - 1) % m_slots.size();
+            m_count--;
+        }
+
+        // Re-derive the keyframe that new deltas should reference
+        m_hasKeyframe = false;
+        for (size_t age = 0; age < m_count; ++age) {
+            if (!m_slots[slotAt(age)].snapshot.isDelta()) {
+                m_keyframe = slotAt(age);
+                m_hasKeyframe = true;
+                m_sinceKeyframe = age;
+                break;
+            }
+        }
+        return true;
+    }
+
+    void SnapshotHistory::clear() {
+        for (auto& slot : m_slots) {
+            slot.snapshot.clear();
+        }
+        m_head = 0;
+        m_count = 0;
+        m_sinceKeyframe = 0;
+        m_hasKeyframe = false;
+    }
+
+}
@@ -0,0 +1,169 @@
+// File: src/ECS/RegistrySnapshot.h
+
+/**
+ * RegistrySnapshot.h
+ * Binary registry snapshots for save states, rewind and autosave.
+ * Components are written as packed (entity, value) runs through entt::snapshot
+ * into a reusable byte arena, so capturing is a sequence of small memcpys and
+ * steady-state captures do not allocate.
+ */
+
+#ifndef RUNA_ECS_REGISTRYSNAPSHOT_H
+#define RUNA_ECS_REGISTRYSNAPSHOT_H
+
+#include "../RunaAPI.h"
+#include <entt/entt.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace Runa::ECS {
+
+    /**
+     * SnapshotArena - Growable byte buffer that keeps its capacity across clear().
+     * Unlike std::vector<std::byte>, growing does not zero the new bytes.
+     */
+    class RUNA_API SnapshotArena {
+    public:
+        explicit SnapshotArena(size_t reserveBytes = 0) { reserve(reserveBytes); }
+
+        void reserve(size_t bytes);
+        void clear() { m_size = 0; }
+
+        // Append uninitialized space and return a pointer to it (valid until the next append)
+        std::byte* append(size_t bytes);
+
+        void assign(const std::byte* data, size_t bytes);
+
+        std::byte* data() { return m_data.get(); }
+        const std::byte* data() const { return m_data.get(); }
+        size_t size() const { return m_size; }
+        size_t capacity() const { return m_capacity; }
+
+    private:
+        std::unique_ptr<std::byte[]> m_data;
+        size_t m_size = 0;
+        size_t m_capacity = 0;
+    };
+
+    /**
+     * RegistrySnapshot - One captured registry state.
+     *
+     * Captures the entity storage and every component type in the snapshot list
+     * (see RegistrySnapshot.cpp). Those components must be trivially copyable.
+     * restore() rebuilds the registry's QuestTracker, if it has one.
+     * Sprite::spriteSheet and StringId fields are stored as-is, so a snapshot is
+     * only meaningful to the process that captured it unless they are remapped.
+     *
+     * A delta snapshot stores, per component type, only the components added,
+     * changed or removed relative to a full base snapshot. It can only be
+     * restored together with that base.
+     */
+    class RUNA_API RegistrySnapshot {
+    public:
+        explicit RegistrySnapshot(size_t reserveBytes = 0) : m_arena(reserveBytes) {}
+
+        void reserve(size_t bytes) { m_arena.reserve(bytes); }
+
+        /**
+         * Capture the full state of the registry.
+         */
+        void capture(const entt::registry& registry);
+
+        /**
+         * Capture only the components that differ from a full base snapshot.
+         * @return false if base is not a valid full snapshot
+         */
+        bool captureDelta(const entt::registry& registry, const RegistrySnapshot& base);
+
+        /**
+         * Replace the registry's entities and snapshot components with this state.
+         * Components outside the snapshot list are cleared along with their entities;
+         * registry context variables are left untouched.
+         * @param base The full snapshot a delta was captured against (ignored for full snapshots)
+         * @return false if the data is malformed or a delta's base is missing
+         */
+        bool restore(entt::registry& registry, const RegistrySnapshot* base = nullptr) const;
+
+        /**
+         * Load raw snapshot bytes (e.g. read from disk) and validate them.
+         * @return false if the bytes are not a snapshot of the current component layout
+         */
+        bool assign(std::span<const std::byte> bytes);
+
+        void clear() { m_arena.clear(); }
+
+        bool empty() const { return m_arena.size() == 0; }
+        bool isDelta() const;
+        bool isValid() const;
+
+        std::span<const std::byte> bytes() const { return {m_arena.data(), m_arena.size()}; }
+        // Number of live entities captured
+        size_t getEntityCount() const;
+
+    private:
+        struct Section {
+            const std::byte* data = nullptr;
+            size_t size = 0;
+        };
+
+        Section section(uint32_t index) const;
+        void beginSections(uint16_t flags);
+        void markSection(uint32_t index);
+        void endSections();
+
+        SnapshotArena m_arena;
+    };
+
+    /**
+     * SnapshotHistory - Ring buffer of recent snapshots for rewind.
+     * Every keyframeInterval-th record is a full snapshot; the others are deltas
+     * against the latest keyframe. Slots are reused, so recording does not
+     * allocate once each slot has grown to its working size.
+     */
+    class RUNA_API SnapshotHistory {
+    public:
+        /**
+         * @param capacity Number of states kept
+         * @param keyframeInterval 1 records only full snapshots
+         * @param reserveBytes Initial arena size per slot
+         */
+        explicit SnapshotHistory(size_t capacity, size_t keyframeInterval = 1, size_t reserveBytes = 0);
+
+        void record(const entt::registry& registry);
+
+        /**
+         * Restore the state recorded `steps` records ago (0 = latest) and discard
+         * everything newer, so recording continues from that point.
+         * @return false if fewer than steps + 1 states are available
+         */
+        bool rewind(entt::registry& registry, size_t steps = 0);
+
+        void clear();
+
+        size_t size() const { return m_count; }
+        size_t capacity() const { return m_slots.size(); }
+
+    private:
+        struct Slot {
+            RegistrySnapshot snapshot;
+            size_t base = 0;    // Slot index of the keyframe (deltas only)
+        };
+
+        size_t slotAt(size_t age) const;    // age 0 = newest
+        void popOldest();
+
+        std::vector<Slot> m_slots;
+        size_t m_keyframeInterval;
+        size_t m_head = 0;          // Next slot to write
+        size_t m_count = 0;
+        size_t m_sinceKeyframe = 0;
+        bool m_hasKeyframe = false;
+        size_t m_keyframe = 0;      // Slot of the newest keyframe
+    };
+
+}
+
+#endif // RUNA_ECS_REGISTRYSNAPSHOT_H
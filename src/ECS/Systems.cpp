@@ -2,10 +2,15 @@
 #include "../runapch.h"
 #include "Systems.h"
 #include "Components.h"
+#include "Archetypes.h"
+#include "EventBus.h"
+#include "Events.h"
 #include "../Core/Input.h"
+#include "../Core/JobSystem.h"
 #include "../Core/Keybindings.h"
 #include "../Graphics/SpriteBatch.h"
 #include "../Graphics/Camera.h"
+#include "../Graphics/RenderSnapshot.h"
 #include "../Graphics/TileMap.h"
 #include "../Graphics/Texture.h"
 #include "../Collision/CollisionMap.h"
@@ -15,6 +20,28 @@
 
 namespace Runa::ECS::Systems {
 
+// Entities per job when a system is split across the JobSystem; smaller views run inline
+static constexpr size_t PARALLEL_GRAIN = 1024;
+
+// Calls fn(entity) for each entity of view, split over the view's leading storage.
+// fn may only write components of the entity it is given
+template<typename View, typename Func>
+static void parallelEach(const View& view, Func&& fn) {
+    const auto* handle = view.handle();
+    if (!handle) {
+        return;
+    }
+
+    JobSystem::parallelFor(handle->size(), PARALLEL_GRAIN, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            const entt::entity entity = (*handle)[i];
+            if (view.contains(entity)) {
+                fn(entity);
+            }
+        }
+    });
+}
+
 // Helper function to check if any key in a list is down
 static bool isAnyKeyDown(const Input& input, const std::vector<SDL_Keycode>& keys) {
     for (SDL_Keycode key : keys) {
@@ -87,32 +114,46 @@ void updatePlayerInput(entt::registry& registry, Input& input, float dt, Keybind
 void updateMovement(entt::registry& registry, float dt) {
     auto view = registry.view<Position, Velocity, Active>();
 
-    for (auto entity : view) {
+    parallelEach(view, [&](entt::entity entity) {
         auto& pos = view.get<Position>(entity);
-        auto& vel = view.get<Velocity>(entity);
-
+        const auto& vel = view.get<Velocity>(entity);
 
         pos.x += vel.x * dt;
         pos.y += vel.y * dt;
+    });
+}
+
+void storePreviousPositions(entt::registry& registry) {
+    // Straight over the packed storage; inactive entities are cheap to include
+    for (auto& pos : registry.storage<Position>()) {
+        pos.prevX = pos.x;
+        pos.prevY = pos.y;
     }
 }
 
+void snapPreviousPosition(entt::registry& registry, entt::entity entity) {
+    auto& pos = registry.get<Position>(entity);
+    pos.prevX = pos.x;
+    pos.prevY = pos.y;
+}
+
 
 void updateAnimation(entt::registry& registry, float dt) {
     auto view = registry.view<Sprite, Animation, Active>();
 
-    for (auto entity : view) {
-        auto& sprite = view.get<Sprite>(entity);
+    // Sprite sheets are only read here, so entities can advance in parallel
+    parallelEach(view, [&](entt::entity entity) {
+        const auto& sprite = view.get<Sprite>(entity);
         auto& anim = view.get<Animation>(entity);
 
 
-        if (!sprite.spriteSheet || sprite.spriteName.empty()) {
-            continue;
+        if (!sprite.spriteSheet || sprite.spriteName == NullStringId) {
+            return;
         }
 
         const auto* spriteData = sprite.spriteSheet->getSprite(sprite.spriteName);
         if (!spriteData || spriteData->frames.empty()) {
-            continue;
+            return;
         }
 
 
@@ -131,90 +172,101 @@ void updateAnimation(entt::registry& registry, float dt) {
         } else {
             anim.currentFrame = 0;
         }
-    }
+    });
 }
 
 
+// Entities without an AABB collide using their Size
+using TileCollisionArchetypes = SystemArchetypes<
+    entt::type_list<Position, Size, Active>,
+    entt::type_list<AABB>,
+    entt::type_list<
+        Archetype<>,
+        Archetype<AABB>>>;
+
 void updateTileCollisions(entt::registry& registry, const TileMap& tilemap, int tileSize) {
-    auto view = registry.view<Position, Size, Active>();
+    TileCollisionArchetypes::each(registry, [&](auto view, auto archetype) {
+        using Has = decltype(archetype);
 
-    for (auto entity : view) {
-        auto& pos = view.get<Position>(entity);
-        auto& size = view.get<Size>(entity);
+        for (auto entity : view) {
+            auto& pos = view.template get<Position>(entity);
+            auto& size = view.template get<Size>(entity);
 
 
-        float offsetX = 0.0f;
-        float offsetY = 0.0f;
-        float boxWidth = size.width;
-        float boxHeight = size.height;
+            float offsetX = 0.0f;
+            float offsetY = 0.0f;
+            float boxWidth = size.width;
+            float boxHeight = size.height;
 
-        if (auto* aabb = registry.try_get<AABB>(entity)) {
-            offsetX = aabb->offsetX;
-            offsetY = aabb->offsetY;
-            boxWidth = aabb->width;
-            boxHeight = aabb->height;
-        }
+            if constexpr (archetypeHas<Has, AABB>) {
+                const auto& aabb = view.template get<AABB>(entity);
+                offsetX = aabb.offsetX;
+                offsetY = aabb.offsetY;
+                boxWidth = aabb.width;
+                boxHeight = aabb.height;
+            }
 
 
-        float worldX = pos.x + offsetX;
-        float worldY = pos.y + offsetY;
+            float worldX = pos.x + offsetX;
+            float worldY = pos.y + offsetY;
 
 
-        int startX = static_cast<int>(worldX / tileSize);
-        int endX = static_cast<int>((worldX + boxWidth) / tileSize);
-        int startY = static_cast<int>(worldY / tileSize);
-        int endY = static_cast<int>((worldY + boxHeight) / tileSize);
+            int startX = static_cast<int>(worldX / tileSize);
+            int endX = static_cast<int>((worldX + boxWidth) / tileSize);
+            int startY = static_cast<int>(worldY / tileSize);
+            int endY = static_cast<int>((worldY + boxHeight) / tileSize);
 
 
-        for (int ty = startY; ty <= endY; ++ty) {
-            for (int tx = startX; tx <= endX; ++tx) {
+            for (int ty = startY; ty <= endY; ++ty) {
+                for (int tx = startX; tx <= endX; ++tx) {
 
-                if (tx < 0 || tx >= tilemap.getWidth() || ty < 0 || ty >= tilemap.getHeight()) {
-                    continue;
-                }
+                    if (tx < 0 || tx >= tilemap.getWidth() || ty < 0 || ty >= tilemap.getHeight()) {
+                        continue;
+                    }
 
-                int tileIndex = tilemap.getTile(tx, ty);
-                if (tilemap.isSolidTile(tileIndex)) {
+                    int tileIndex = tilemap.getTile(tx, ty);
+                    if (tilemap.isSolidTile(tileIndex)) {
 
-                    AABB::WorldAABB tileBox{
-                        static_cast<float>(tx * tileSize),
-                        static_cast<float>(ty * tileSize),
-                        static_cast<float>(tileSize),
-                        static_cast<float>(tileSize)
-                    };
+                        AABB::WorldAABB tileBox{
+                            static_cast<float>(tx * tileSize),
+                            static_cast<float>(ty * tileSize),
+                            static_cast<float>(tileSize),
+                            static_cast<float>(tileSize)
+                        };
 
-                    AABB::WorldAABB entityBox{worldX, worldY, boxWidth, boxHeight};
+                        AABB::WorldAABB entityBox{worldX, worldY, boxWidth, boxHeight};
 
-                    if (entityBox.intersects(tileBox)) {
+                        if (entityBox.intersects(tileBox)) {
 
-                        float overlapX = std::min(entityBox.x + entityBox.width, tileBox.x + tileBox.width)
-                                       - std::max(entityBox.x, tileBox.x);
-                        float overlapY = std::min(entityBox.y + entityBox.height, tileBox.y + tileBox.height)
-                                       - std::max(entityBox.y, tileBox.y);
+                            float overlapX = std::min(entityBox.x + entityBox.width, tileBox.x + tileBox.width)
+                                           - std::max(entityBox.x, tileBox.x);
+                            float overlapY = std::min(entityBox.y + entityBox.height, tileBox.y + tileBox.height)
+                                           - std::max(entityBox.y, tileBox.y);
 
 
-                        if (overlapX < overlapY) {
-                            if (entityBox.x < tileBox.x) {
-                                pos.x -= overlapX;
-                            } else {
-                                pos.x += overlapX;
-                            }
-                        } else {
-                            if (entityBox.y < tileBox.y) {
-                                pos.y -= overlapY;
+                            if (overlapX < overlapY) {
+                                if (entityBox.x < tileBox.x) {
+                                    pos.x -= overlapX;
+                                } else {
+                                    pos.x += overlapX;
+                                }
                             } else {
-                                pos.y += overlapY;
+                                if (entityBox.y < tileBox.y) {
+                                    pos.y -= overlapY;
+                                } else {
+                                    pos.y += overlapY;
+                                }
                             }
-                        }
 
 
-                        worldX = pos.x + offsetX;
-                        worldY = pos.y + offsetY;
+                            worldX = pos.x + offsetX;
+                            worldY = pos.y + offsetY;
+                        }
                     }
                 }
             }
         }
-    }
+    });
 }
 
 void updateEntityCollisions(entt::registry& registry) {
@@ -258,95 +310,148 @@ void updateEntityCollisions(entt::registry& registry) {
 
 
 
-void renderSprites(entt::registry& registry, SpriteBatch& batch, Camera& camera, Texture* whitePixelTexture) {
-    auto view = registry.view<Position, Sprite, Active>();
-
-    for (auto entity : view) {
-        auto& pos = view.get<Position>(entity);
-        auto& sprite = view.get<Sprite>(entity);
-
+// Static sprites first so animated actors are drawn over props
+using RenderSpriteArchetypes = SystemArchetypes<
+    entt::type_list<Position, Sprite, Active>,
+    entt::type_list<Size, Animation>,
+    entt::type_list<
+        Archetype<>,                    // Static sprite, default size
+        Archetype<Size>,                // Static sprite
+        Archetype<Animation>,           // Animated sprite, default size
+        Archetype<Size, Animation>>>;   // Animated sprite
 
-        int screenX, screenY;
-        camera.worldToScreen(pos.x, pos.y, screenX, screenY);
+void extractSprites(entt::registry& registry, RenderSnapshot& snapshot, float alpha) {
+    RenderSpriteArchetypes::each(registry, [&](auto view, auto archetype) {
+        using Has = decltype(archetype);
 
+        for (auto entity : view) {
+            auto& pos = view.template get<Position>(entity);
+            auto& sprite = view.template get<Sprite>(entity);
 
-        float width = 32.0f;
-        float height = 32.0f;
-        if (auto* size = registry.try_get<Size>(entity)) {
-            width = size->width;
-            height = size->height;
-        }
+            SpriteInstance instance;
+            instance.x = pos.prevX + (pos.x - pos.prevX) * alpha;
+            instance.y = pos.prevY + (pos.y - pos.prevY) * alpha;
+            instance.tintR = sprite.tintR;
+            instance.tintG = sprite.tintG;
+            instance.tintB = sprite.tintB;
+            instance.tintA = sprite.tintA;
 
 
-        if (sprite.spriteSheet && !sprite.spriteName.empty()) {
-            const auto* spriteData = sprite.spriteSheet->getSprite(sprite.spriteName);
-            if (spriteData && !spriteData->frames.empty()) {
+            if (sprite.spriteSheet && sprite.spriteName != NullStringId) {
+                const auto* spriteData = sprite.spriteSheet->getSprite(sprite.spriteName);
+                if (spriteData && !spriteData->frames.empty()) {
 
-                int frameIndex = 0;
-                if (auto* anim = registry.try_get<Animation>(entity)) {
-                    frameIndex = anim->currentFrame;
-                    if (frameIndex >= static_cast<int>(spriteData->frames.size())) {
-                        frameIndex = 0;
+                    int frameIndex = 0;
+                    if constexpr (archetypeHas<Has, Animation>) {
+                        frameIndex = view.template get<Animation>(entity).currentFrame;
+                        if (frameIndex >= static_cast<int>(spriteData->frames.size())) {
+                            frameIndex = 0;
+                        }
                     }
-                }
 
-                const SpriteFrame& frame = spriteData->frames[frameIndex];
-                float pixelScale = SpriteBatch::getPixelScale();
-                // Sprite rendered size is frame size * pixelScale (zoom only affects world-to-screen, not sprite size)
-                float spriteWidthPixels = frame.width * pixelScale;
-                float spriteHeightPixels = frame.height * pixelScale;
-
-                // Simple centering - flip compensation is handled in SpriteBatch
-                float halfWidth = spriteWidthPixels * 0.5f;
-                float halfHeight = spriteHeightPixels * 0.5f;
-                int drawX = static_cast<int>(screenX - halfWidth);
-                int drawY = static_cast<int>(screenY - halfHeight);
+                    const SpriteFrame& frame = spriteData->frames[frameIndex];
+                    instance.texture = &sprite.spriteSheet->getTexture();
+                    instance.srcX = frame.x;
+                    instance.srcY = frame.y;
+                    instance.srcWidth = frame.width;
+                    instance.srcHeight = frame.height;
+                    instance.flipX = sprite.flipX;
+                    instance.flipY = sprite.flipY;
+                    snapshot.sprites.push_back(instance);
+                    continue;
+                }
+            }
 
 
-                batch.draw(sprite.spriteSheet->getTexture(), drawX, drawY, frame,
-                           sprite.tintR, sprite.tintG, sprite.tintB, sprite.tintA,
-                           1.0f, 1.0f, sprite.flipX, sprite.flipY);
-                continue;
+            instance.width = 32.0f;
+            instance.height = 32.0f;
+            if constexpr (archetypeHas<Has, Size>) {
+                const auto& size = view.template get<Size>(entity);
+                instance.width = size.width;
+                instance.height = size.height;
             }
+            snapshot.sprites.push_back(instance);
         }
+    });
+}
 
+// Draws snapshot.sprites[begin, end) on a SpriteBatch or one of its sub-batches.
+// Positions stay in world units; the batch's camera moves and zooms them on the GPU
+template<typename Batch>
+static void drawSpriteRange(const RenderSnapshot& snapshot, size_t begin, size_t end, Batch& batch,
+                            Texture* whitePixelTexture) {
+    for (size_t i = begin; i < end; ++i) {
+        const auto& instance = snapshot.sprites[i];
+
+        if (instance.texture) {
+            // Centred on the entity, one world unit per texel - flip compensation is handled in SpriteBatch
+            batch.draw(*instance.texture,
+                       instance.x - instance.srcWidth * 0.5f, instance.y - instance.srcHeight * 0.5f,
+                       instance.srcX, instance.srcY, instance.srcWidth, instance.srcHeight,
+                       instance.tintR, instance.tintG, instance.tintB, instance.tintA,
+                       1.0f, 1.0f, instance.flipX, instance.flipY);
+        } else if (whitePixelTexture && whitePixelTexture->isValid()) {
+            // Fallback quad is the entity's size in world units
+            batch.draw(*whitePixelTexture,
+                       instance.x - instance.width * 0.5f, instance.y - instance.height * 0.5f, 0, 0, 1, 1,
+                       instance.tintR, instance.tintG, instance.tintB, instance.tintA,
+                       instance.width, instance.height);
+        }
+    }
+}
 
-        if (whitePixelTexture && whitePixelTexture->isValid()) {
-            float pixelScale = SpriteBatch::getPixelScale();
-            // Rendered size is width * pixelScale (zoom only affects world-to-screen)
-            float fallbackWidthPixels = width * pixelScale;
-            float fallbackHeightPixels = height * pixelScale;
-            int drawX = screenX - static_cast<int>(fallbackWidthPixels * 0.5f);
-            int drawY = screenY - static_cast<int>(fallbackHeightPixels * 0.5f);
+void drawSprites(const RenderSnapshot& snapshot, SpriteBatch& batch, Texture* whitePixelTexture) {
+    const size_t count = snapshot.sprites.size();
+    if (count <= PARALLEL_GRAIN || !JobSystem::isRunning()) {
+        drawSpriteRange(snapshot, 0, count, batch, whitePixelTexture);
+        return;
+    }
 
-            batch.draw(*whitePixelTexture, drawX, drawY, 0, 0, 1, 1,
-                       sprite.tintR, sprite.tintG, sprite.tintB, sprite.tintA,
-                       width / 3.0f, height / 3.0f);
+    // One sub-batch per slice of the snapshot; merged in order, so the batch ends
+    // up exactly as if the slices had been drawn one after another
+    const size_t slices = (count + PARALLEL_GRAIN - 1) / PARALLEL_GRAIN;
+    std::span<SpriteBatch::SubBatch> subBatches = batch.beginSubBatches(slices);
+    JobSystem::parallelFor(subBatches.size(), 1, [&](size_t begin, size_t end) {
+        for (size_t slice = begin; slice < end; ++slice) {
+            drawSpriteRange(snapshot, slice * PARALLEL_GRAIN, std::min(count, (slice + 1) * PARALLEL_GRAIN),
+                            subBatches[slice], whitePixelTexture);
         }
-    }
+    });
+    batch.mergeSubBatches();
+}
+
+void renderSprites(entt::registry& registry, SpriteBatch& batch, Texture* whitePixelTexture, float alpha) {
+    // Scratch snapshot reused across frames; renderSprites is only called from the render thread
+    static thread_local RenderSnapshot scratch;
+    scratch.clear();
+    extractSprites(registry, scratch, alpha);
+    drawSprites(scratch, batch, whitePixelTexture);
 }
 
 
 
 
 
-void updateCameraFollow(entt::registry& registry, Camera& camera, float dt) {
+void updateCameraFollow(entt::registry& registry, Camera& camera, float dt, float alpha) {
     auto view = registry.view<Position, Size, CameraTarget, Active>();
 
     for (auto entity : view) {
         auto& pos = view.get<Position>(entity);
         auto& size = view.get<Size>(entity);
 
-        float centerX = pos.x + size.width * 0.5f;
-        float centerY = pos.y + size.height * 0.5f;
+        float centerX = pos.prevX + (pos.x - pos.prevX) * alpha + size.width * 0.5f;
+        float centerY = pos.prevY + (pos.y - pos.prevY) * alpha + size.height * 0.5f;
 
         camera.setPosition(centerX, centerY);
         break;
     }
 }
 
-void updateMapCollision(entt::registry& registry, CollisionMap& collisionMap, float dt,
-                        std::function<void(entt::entity, const CollisionEvent&)> onCollision) {
+namespace {
+
+// emit(entity, const CollisionEvent&)
+template<typename Emit>
+void mapCollisionImpl(entt::registry& registry, CollisionMap& collisionMap, float dt, Emit&& emit) {
     auto view = registry.view<Position, Velocity, AABB, Collider, Active>();
 
     for (auto entity : view) {
@@ -416,12 +521,10 @@ void updateMapCollision(entt::registry& registry, CollisionMap& collisionMap, fl
                 bool wasMovingRight = vel.x > 0.0f;
                 vel.x = 0.0f;
 
-                if (onCollision) {
-                    CollisionEvent event;
-                    event.fromLeft = wasMovingLeft;
-                    event.fromRight = wasMovingRight;
-                    onCollision(entity, event);
-                }
+                CollisionEvent event;
+                event.fromLeft = wasMovingLeft;
+                event.fromRight = wasMovingRight;
+                emit(entity, event);
             }
         }
 
@@ -470,12 +573,10 @@ void updateMapCollision(entt::registry& registry, CollisionMap& collisionMap, fl
                 bool wasMovingDown = vel.y > 0.0f;
                 vel.y = 0.0f;
 
-                if (onCollision) {
-                    CollisionEvent event;
-                    event.fromTop = wasMovingUp;
-                    event.fromBottom = wasMovingDown;
-                    onCollision(entity, event);
-                }
+                CollisionEvent event;
+                event.fromTop = wasMovingUp;
+                event.fromBottom = wasMovingDown;
+                emit(entity, event);
             }
         }
 
@@ -492,8 +593,9 @@ void updateMapCollision(entt::registry& registry, CollisionMap& collisionMap, fl
     }
 }
 
-void updateEntityToEntityCollision(entt::registry& registry,
-                                   std::function<void(entt::entity, entt::entity, const CollisionEvent&)> onCollision) {
+// emit(entityA, entityB, const CollisionEvent&)
+template<typename Emit>
+void entityToEntityCollisionImpl(entt::registry& registry, Emit&& emit) {
     auto view = registry.view<Position, AABB, Collider, Active>();
 
     std::vector<entt::entity> entities(view.begin(), view.end());
@@ -540,9 +642,7 @@ void updateEntityToEntityCollision(entt::registry& registry,
                 event.fromTop = ay < by;
                 event.fromBottom = ay > by;
 
-                if (onCollision) {
-                    onCollision(entityA, entityB, event);
-                }
+                emit(entityA, entityB, event);
 
                 // Resolve collision if both are solid
                 if (colliderA.blocksMovement && colliderB.blocksMovement) {
@@ -572,8 +672,9 @@ void updateEntityToEntityCollision(entt::registry& registry,
     }
 }
 
-void updateInteraction(entt::registry& registry, Input& input, int interactionKey,
-                       std::function<void(entt::entity, entt::entity, Interactable&)> onInteract) {
+// emit(interactor, target, Interactable&), called before oneTime consumption
+template<typename Emit>
+void interactionImpl(entt::registry& registry, Input& input, int interactionKey, Emit&& emit) {
     // Find entities that can interact (usually the player)
     auto interactors = registry.view<Position, Size, CanInteract, Active>();
     auto interactables = registry.view<Position, Size, Interactable, Active>();
@@ -621,8 +722,8 @@ void updateInteraction(entt::registry& registry, Input& input, int interactionKe
             }
         }
 
-        if (closest != entt::null && closestInteractable && onInteract) {
-            onInteract(interactor, closest, *closestInteractable);
+        if (closest != entt::null && closestInteractable) {
+            emit(interactor, closest, *closestInteractable);
 
             if (closestInteractable->oneTime) {
                 closestInteractable->consumed = true;
@@ -631,9 +732,10 @@ void updateInteraction(entt::registry& registry, Input& input, int interactionKe
     }
 }
 
-void updateTileInteraction(entt::registry& registry, CollisionMap& collisionMap,
-                           Input& input, int interactionKey,
-                           std::function<void(entt::entity, TileInteraction&)> onInteract) {
+// emit(entity, TileInteraction&), called before oneTime consumption
+template<typename Emit>
+void tileInteractionImpl(entt::registry& registry, CollisionMap& collisionMap,
+                         Input& input, int interactionKey, Emit&& emit) {
     auto view = registry.view<Position, Size, CanInteract, Active>();
 
     bool keyPressed = input.isKeyPressed(static_cast<SDL_Keycode>(interactionKey));
@@ -652,8 +754,8 @@ void updateTileInteraction(entt::registry& registry, CollisionMap& collisionMap,
         auto interactions = collisionMap.getInteractionsInRange(cx, cy, canInteract.range);
 
         for (TileInteraction* interaction : interactions) {
-            if (interaction && !interaction->consumed && onInteract) {
-                onInteract(entity, *interaction);
+            if (interaction && !interaction->consumed) {
+                emit(entity, *interaction);
 
                 if (interaction->oneTime) {
                     interaction->consumed = true;
@@ -664,6 +766,69 @@ void updateTileInteraction(entt::registry& registry, CollisionMap& collisionMap,
     }
 }
 
+}
+
+void updateMapCollision(entt::registry& registry, CollisionMap& collisionMap, float dt) {
+    auto writer = EventBus::get(registry).writer<MapCollisionEvent>();
+    mapCollisionImpl(registry, collisionMap, dt, [&](entt::entity entity, const CollisionEvent& event) {
+        writer.push({entity, event});
+    });
+}
+
+void updateMapCollision(entt::registry& registry, CollisionMap& collisionMap, float dt,
+                        std::function<void(entt::entity, const CollisionEvent&)> onCollision) {
+    mapCollisionImpl(registry, collisionMap, dt, [&](entt::entity entity, const CollisionEvent& event) {
+        if (onCollision) {
+            onCollision(entity, event);
+        }
+    });
+}
+
+void updateEntityToEntityCollision(entt::registry& registry) {
+    auto writer = EventBus::get(registry).writer<EntityCollisionEvent>();
+    entityToEntityCollisionImpl(registry, [&](entt::entity a, entt::entity b, const CollisionEvent& event) {
+        writer.push({a, b, event});
+    });
+}
+
+void updateEntityToEntityCollision(entt::registry& registry,
+                                   std::function<void(entt::entity, entt::entity, const CollisionEvent&)> onCollision) {
+    entityToEntityCollisionImpl(registry, [&](entt::entity a, entt::entity b, const CollisionEvent& event) {
+        if (onCollision) {
+            onCollision(a, b, event);
+        }
+    });
+}
+
+void updateInteraction(entt::registry& registry, Input& input, int interactionKey) {
+    auto writer = EventBus::get(registry).writer<InteractionEvent>();
+    interactionImpl(registry, input, interactionKey, [&](entt::entity interactor, entt::entity target, Interactable& interactable) {
+        writer.push({interactor, target, interactable});
+    });
+}
+
+void updateInteraction(entt::registry& registry, Input& input, int interactionKey,
+                       std::function<void(entt::entity, entt::entity, Interactable&)> onInteract) {
+    // Nothing is consumed when no handler is attached
+    if (!onInteract) return;
+    interactionImpl(registry, input, interactionKey, onInteract);
+}
+
+void updateTileInteraction(entt::registry& registry, CollisionMap& collisionMap,
+                           Input& input, int interactionKey) {
+    auto writer = EventBus::get(registry).writer<TileInteractionEvent>();
+    tileInteractionImpl(registry, collisionMap, input, interactionKey, [&](entt::entity entity, TileInteraction& interaction) {
+        writer.push({entity, &interaction});
+    });
+}
+
+void updateTileInteraction(entt::registry& registry, CollisionMap& collisionMap,
+                           Input& input, int interactionKey,
+                           std::function<void(entt::entity, TileInteraction&)> onInteract) {
+    if (!onInteract) return;
+    tileInteractionImpl(registry, collisionMap, input, interactionKey, onInteract);
+}
+
 std::vector<entt::entity> getInteractablesInRange(entt::registry& registry,
                                                    entt::entity source, float range) {
     std::vector<entt::entity> result;
@@ -16,6 +16,7 @@ namespace Runa {
     class TileMap;
     class Texture;
     class CollisionMap;
+    struct RenderSnapshot;
 }
 
 namespace Runa::ECS {
@@ -43,13 +44,24 @@ RUNA_API void updatePlayerInput(entt::registry& registry, Input& input, float dt
 
 
 
+// Split across the JobSystem for large views
 RUNA_API void updateMovement(entt::registry& registry, float dt);
 
+/**
+ * Copy every Position into prevX/prevY. Call once at the start of each fixed
+ * tick, before anything moves, so renderSprites can interpolate.
+ */
+RUNA_API void storePreviousPositions(entt::registry& registry);
+
+// on_construct<Position> listener: sets prevX/prevY to the new position
+RUNA_API void snapPreviousPosition(entt::registry& registry, entt::entity entity);
 
 
 
 
 
+
+// Split across the JobSystem for large views
 RUNA_API void updateAnimation(entt::registry& registry, float dt);
 
 
@@ -61,42 +73,54 @@ RUNA_API void updateTileCollisions(entt::registry& registry, const TileMap& tile
 
 RUNA_API void updateEntityCollisions(entt::registry& registry);
 
+/*
+ * The collision and interaction systems below come in two forms:
+ * - Without a callback, events are appended to the registry's EventBus
+ *   (see Events.h) and delivered in batches at EventBus::dispatch().
+ * - With a callback, it is invoked synchronously for each event.
+ */
+
 /**
  * Update collision with CollisionMap (pixel-perfect tile collision)
+ * Publishes MapCollisionEvent.
  * @param registry ECS registry
  * @param collisionMap The collision map with tile data
  * @param dt Delta time for movement prediction
- * @param onCollision Optional callback when collision occurs
  */
+RUNA_API void updateMapCollision(entt::registry& registry, CollisionMap& collisionMap, float dt);
 RUNA_API void updateMapCollision(entt::registry& registry, CollisionMap& collisionMap, float dt,
-                                  std::function<void(entt::entity, const CollisionEvent&)> onCollision = nullptr);
+                                  std::function<void(entt::entity, const CollisionEvent&)> onCollision);
 
 /**
  * Check and resolve entity-to-entity collisions
+ * Publishes EntityCollisionEvent.
  * @param registry ECS registry  
- * @param onCollision Optional callback for collision events
  */
+RUNA_API void updateEntityToEntityCollision(entt::registry& registry);
 RUNA_API void updateEntityToEntityCollision(entt::registry& registry,
-                                             std::function<void(entt::entity, entt::entity, const CollisionEvent&)> onCollision = nullptr);
+                                             std::function<void(entt::entity, entt::entity, const CollisionEvent&)> onCollision);
 
 /**
  * Update interaction system - detects when player can interact and handles input
+ * Publishes InteractionEvent.
  * @param registry ECS registry
  * @param input Input handler
  * @param interactionKey Key to trigger interaction
- * @param onInteract Callback when interaction occurs
  */
+RUNA_API void updateInteraction(entt::registry& registry, Input& input, int interactionKey);
 RUNA_API void updateInteraction(entt::registry& registry, Input& input, int interactionKey,
                                  std::function<void(entt::entity, entt::entity, Interactable&)> onInteract);
 
 /**
  * Update interaction with CollisionMap tiles
+ * Publishes TileInteractionEvent.
  * @param registry ECS registry
  * @param collisionMap The collision map with interaction data
  * @param input Input handler
  * @param interactionKey Key to trigger interaction
- * @param onInteract Callback when tile interaction occurs
  */
+RUNA_API void updateTileInteraction(entt::registry& registry, CollisionMap& collisionMap,
+                                     Input& input, int interactionKey);
 RUNA_API void updateTileInteraction(entt::registry& registry, CollisionMap& collisionMap,
                                      Input& input, int interactionKey,
                                      std::function<void(entt::entity, TileInteraction&)> onInteract);
@@ -113,14 +137,31 @@ RUNA_API std::vector<entt::entity> getInteractablesInRange(entt::registry& regis
 
 
 
-RUNA_API void renderSprites(entt::registry& registry, SpriteBatch& batch, Camera& camera, Texture* whitePixelTexture = nullptr);
+/**
+ * Draw sprites at prev + (current - prev) * alpha, where alpha is the fraction of
+ * a tick elapsed since the last one (Application::getInterpolationAlpha()).
+ * Positions are submitted in world units, so the batch should be begun with the
+ * camera to view them through.
+ */
+RUNA_API void renderSprites(entt::registry& registry, SpriteBatch& batch,
+                            Texture* whitePixelTexture = nullptr, float alpha = 1.0f);
+
+/**
+ * Split form of renderSprites for pipelined scenes: extractSprites copies
+ * every visible sprite with its interpolated position into the snapshot
+ * (simulation thread); drawSprites submits a snapshot (render thread).
+ */
+RUNA_API void extractSprites(entt::registry& registry, RenderSnapshot& snapshot, float alpha);
+RUNA_API void drawSprites(const RenderSnapshot& snapshot, SpriteBatch& batch,
+                          Texture* whitePixelTexture = nullptr);
 
 
 
 
 
 
-RUNA_API void updateCameraFollow(entt::registry& registry, Camera& camera, float dt);
+// Pass the render alpha when following from onRender so the camera matches interpolated sprites
+RUNA_API void updateCameraFollow(entt::registry& registry, Camera& camera, float dt, float alpha = 1.0f);
 
 }
 
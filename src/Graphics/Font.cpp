@@ -76,6 +76,18 @@ std::unique_ptr<Texture> Font::renderText(const std::string& text, SDL_Color col
     }
 
 
+    // Headless: measure instead of rasterizing
+    if (m_renderer.isHeadless()) {
+        int width = 0;
+        int height = 0;
+        if (!TTF_GetStringSize(m_font, text.c_str(), text.length(), &width, &height)) {
+            LOG_ERROR("Failed to measure text '{}': {}", text, SDL_GetError());
+            return nullptr;
+        }
+        return std::make_unique<Texture>(m_renderer, width, height, nullptr);
+    }
+
+
 
     SDL_Surface* textSurface = TTF_RenderText_Blended(m_font, text.c_str(), text.length(), color);
     if (!textSurface) {
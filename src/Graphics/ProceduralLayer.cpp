@@ -0,0 +1,188 @@
+// File: src/Graphics/ProceduralLayer.cpp
+
+/**
+ * ProceduralLayer.cpp
+ * Worker-thread chunk generation, distance eviction and instance copying.
+ */
+
+#include "../runapch.h"
+#include "ProceduralLayer.h"
+#include "Camera.h"
+#include "SpriteBatch.h"
+#include "Core/Log.h"
+#include <cmath>
+
+namespace Runa {
+
+    ProceduralLayer::ProceduralLayer(int tileSize, uint32_t seed)
+        : m_tileSize(std::max(1, tileSize)), m_seed(seed) {}
+
+    ProceduralLayer::~ProceduralLayer() {
+        // Jobs write into chunks this layer owns
+        JobSystem::wait(m_jobs);
+    }
+
+    uint64_t ProceduralLayer::chunkKey(int chunkX, int chunkY) {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(chunkX)) << 32) | static_cast<uint32_t>(chunkY);
+    }
+
+    // Rounds towards negative infinity, so tile -1 lands in chunk -1
+    int ProceduralLayer::floorDiv(int value, int divisor) {
+        int quotient = value / divisor;
+        if ((value % divisor != 0) && ((value < 0) != (divisor < 0))) {
+            quotient--;
+        }
+        return quotient;
+    }
+
+    // Spatial hash of the coordinates through the murmur3 finaliser
+    uint32_t ProceduralLayer::hashTile(uint32_t seed, int tileX, int tileY) {
+        uint32_t hash = static_cast<uint32_t>(tileX) * 73856093u + static_cast<uint32_t>(tileY) * 19349663u +
+                        seed * 83492791u;
+        hash ^= hash >> 16;
+        hash *= 2246822507u;
+        hash ^= hash >> 13;
+        hash *= 3266489917u;
+        hash ^= hash >> 16;
+        return hash;
+    }
+
+    int ProceduralLayer::addDecoration(const Texture& texture, const SpriteFrame& frame) {
+        if (m_started) {
+            LOG_WARN("ProceduralLayer: Decorations can't be added after generation has started");
+            return -1;
+        }
+        if (m_decorations.size() >= UINT16_MAX) {
+            LOG_WARN("ProceduralLayer: Too many decorations");
+            return -1;
+        }
+
+        uint16_t group = 0;
+        for (const auto& decoration : m_decorations) {
+            group = std::max<uint16_t>(group, static_cast<uint16_t>(decoration.group + 1));
+            if (decoration.texture == &texture) {
+                group = decoration.group;
+                break;
+            }
+        }
+
+        m_decorations.push_back(Decoration{&texture, frame, group});
+        return static_cast<int>(m_decorations.size() - 1);
+    }
+
+    void ProceduralLayer::setGenerator(Generator generator) {
+        clear();
+        m_generator = std::move(generator);
+    }
+
+    void ProceduralLayer::clear() {
+        JobSystem::wait(m_jobs);
+        m_chunks.clear();
+    }
+
+    // Worker side: generate, drop unknown decorations and group by texture so
+    // render() appends each run in one go
+    void ProceduralLayer::generate(Chunk& chunk, int chunkX, int chunkY) const {
+        std::vector<Instance> instances;
+        m_generator(chunkX * CHUNK_TILES, chunkY * CHUNK_TILES, m_seed, instances);
+
+        const size_t decorationCount = m_decorations.size();
+        std::erase_if(instances, [decorationCount](const Instance& instance) {
+            return instance.decoration >= decorationCount ||
+                   instance.tile >= CHUNK_TILES * CHUNK_TILES;
+        });
+        std::stable_sort(instances.begin(), instances.end(), [this](const Instance& a, const Instance& b) {
+            return m_decorations[a.decoration].group < m_decorations[b.decoration].group;
+        });
+        instances.shrink_to_fit();
+
+        chunk.instances = std::move(instances);
+        chunk.ready.store(true, std::memory_order_release);
+    }
+
+    void ProceduralLayer::render(SpriteBatch& batch, const Camera& camera, float depth) {
+        if (!m_generator) {
+            return;
+        }
+
+        const auto bounds = camera.getWorldBounds();
+        const int chunkPixels = CHUNK_TILES * m_tileSize;
+        const int firstChunkX = floorDiv(static_cast<int>(std::floor(bounds.left)), chunkPixels);
+        const int firstChunkY = floorDiv(static_cast<int>(std::floor(bounds.top)), chunkPixels);
+        const int lastChunkX = floorDiv(static_cast<int>(std::ceil(bounds.right)), chunkPixels);
+        const int lastChunkY = floorDiv(static_cast<int>(std::ceil(bounds.bottom)), chunkPixels);
+
+        for (int chunkY = firstChunkY; chunkY <= lastChunkY; ++chunkY) {
+            for (int chunkX = firstChunkX; chunkX <= lastChunkX; ++chunkX) {
+                auto& slot = m_chunks[chunkKey(chunkX, chunkY)];
+                if (!slot) {
+                    slot = std::make_unique<Chunk>();
+                    m_started = true;
+                    Chunk* chunk = slot.get();
+                    JobSystem::run([this, chunk, chunkX, chunkY]() { generate(*chunk, chunkX, chunkY); }, &m_jobs);
+                }
+
+                const Chunk& chunk = *slot;
+                if (!chunk.ready.load(std::memory_order_acquire)) {
+                    continue;
+                }
+
+                const float chunkLeft = static_cast<float>(chunkX * chunkPixels);
+                const float chunkTop = static_cast<float>(chunkY * chunkPixels);
+
+                size_t runStart = 0;
+                while (runStart < chunk.instances.size()) {
+                    const uint16_t group = m_decorations[chunk.instances[runStart].decoration].group;
+                    size_t runEnd = runStart + 1;
+                    while (runEnd < chunk.instances.size() &&
+                           m_decorations[chunk.instances[runEnd].decoration].group == group) {
+                        runEnd++;
+                    }
+
+                    const Texture& texture = *m_decorations[chunk.instances[runStart].decoration].texture;
+                    VK2DDrawCommand* command = batch.appendCommands(texture, runEnd - runStart, depth);
+                    for (size_t i = runStart; command && i < runEnd; ++i, ++command) {
+                        const Instance& instance = chunk.instances[i];
+                        const SpriteFrame& frame = m_decorations[instance.decoration].frame;
+                        const int localX = instance.tile % CHUNK_TILES;
+                        const int localY = instance.tile / CHUNK_TILES;
+
+                        command->texturePos[0] = static_cast<float>(frame.x);
+                        command->texturePos[1] = static_cast<float>(frame.y);
+                        command->texturePos[2] = static_cast<float>(frame.width);
+                        command->texturePos[3] = static_cast<float>(frame.height);
+                        command->pos[0] = chunkLeft + localX * m_tileSize;
+                        command->pos[1] = chunkTop + localY * m_tileSize;
+                    }
+                    runStart = runEnd;
+                }
+            }
+        }
+
+        evictChunks(firstChunkX, firstChunkY, lastChunkX, lastChunkY);
+    }
+
+    // Drops finished chunks more than EVICT_MARGIN chunks outside the view;
+    // chunks still generating are left for a later frame
+    void ProceduralLayer::evictChunks(int firstChunkX, int firstChunkY, int lastChunkX, int lastChunkY) {
+        size_t evicted = 0;
+        for (auto it = m_chunks.begin(); it != m_chunks.end();) {
+            const int chunkX = static_cast<int32_t>(it->first >> 32);
+            const int chunkY = static_cast<int32_t>(it->first & 0xFFFFFFFFu);
+            const bool far = chunkX < firstChunkX - EVICT_MARGIN || chunkX > lastChunkX + EVICT_MARGIN ||
+                             chunkY < firstChunkY - EVICT_MARGIN || chunkY > lastChunkY + EVICT_MARGIN;
+
+            if (far && it->second->ready.load(std::memory_order_acquire)) {
+                it = m_chunks.erase(it);
+                evicted++;
+            } else {
+                ++it;
+            }
+        }
+
+        if (evicted > 0) {
+            LOG_DEBUG("ProceduralLayer: Evicted {} chunks ({} cached)", evicted, m_chunks.size());
+        }
+    }
+
+}
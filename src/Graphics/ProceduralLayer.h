@@ -0,0 +1,115 @@
+// File: src/Graphics/ProceduralLayer.h
+
+/**
+ * ProceduralLayer.h
+ * Seeded decoration scattered over a tile grid, generated a chunk at a time
+ * on JobSystem workers and cached as compact instance arrays.
+ */
+
+#ifndef RUNA_GRAPHICS_PROCEDURALLAYER_H
+#define RUNA_GRAPHICS_PROCEDURALLAYER_H
+
+#include "RunaAPI.h"
+#include "SpriteSheet.h"
+#include "Texture.h"
+#include "../Core/JobSystem.h"
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace Runa {
+
+    class Camera;
+    class SpriteBatch;
+
+    /**
+     * ProceduralLayer - Decorations (flowers, grass blades, pebbles) that are a
+     * pure function of a seed and tile coordinates.
+     *
+     * Register the decoration sprites, then set a generator. The first time a
+     * chunk comes into view its generator runs on a worker; until it finishes
+     * the chunk draws nothing. Finished chunks are a few bytes per decoration,
+     * and chunks farther from the camera than the view plus EVICT_MARGIN chunks
+     * are dropped and regenerated when they come back.
+     *
+     * render() only copies cached instances into the batch in world units, so
+     * the batch must be begun with the camera, which zooms them on the GPU like
+     * a StaticTileLayer underneath.
+     */
+    class RUNA_API ProceduralLayer {
+    public:
+        static constexpr int CHUNK_TILES = 32;              // Chunk edge length in tiles
+        static constexpr int EVICT_MARGIN = 2;              // Chunks kept beyond the view on each side
+
+        // One decoration on one tile: 4 bytes
+        struct Instance {
+            uint16_t tile;          // Chunk-local tile index, y * CHUNK_TILES + x
+            uint16_t decoration;    // Index returned by addDecoration()
+        };
+
+        // Fills `out` for the chunk whose top-left tile is (firstTileX, firstTileY).
+        // Runs on worker threads: it must only read its arguments and immutable data
+        using Generator = std::function<void(int firstTileX, int firstTileY, uint32_t seed,
+                                             std::vector<Instance>& out)>;
+
+        ProceduralLayer(int tileSize, uint32_t seed);
+        ~ProceduralLayer();
+
+        ProceduralLayer(const ProceduralLayer&) = delete;
+        ProceduralLayer& operator=(const ProceduralLayer&) = delete;
+
+        // Register a sprite and get its decoration index; only before the first render().
+        // The texture must outlive the layer
+        int addDecoration(const Texture& texture, const SpriteFrame& frame);
+
+        void setGenerator(Generator generator);
+
+        // Drop every chunk, waiting for any still generating
+        void clear();
+
+        // Queue generation for visible chunks, evict distant ones and copy the
+        // finished visible ones into the batch (depth is the sort depth on the batch's layer)
+        void render(SpriteBatch& batch, const Camera& camera, float depth = 0.0f);
+
+        // Well-mixed hash of a tile; the same (seed, x, y) always gives the same value
+        static uint32_t hashTile(uint32_t seed, int tileX, int tileY);
+
+        int getTileSize() const { return m_tileSize; }
+        uint32_t getSeed() const { return m_seed; }
+        size_t getChunkCount() const { return m_chunks.size(); }
+        size_t getPendingChunkCount() const { return static_cast<size_t>(std::max(0, m_jobs.getPending())); }
+
+    private:
+        struct Decoration {
+            const Texture* texture;
+            SpriteFrame frame;
+            uint16_t group;         // Decorations sharing a texture share a group
+        };
+
+        struct Chunk {
+            std::vector<Instance> instances;    // Sorted by texture group, written once by the worker
+            std::atomic<bool> ready{false};
+        };
+
+        static uint64_t chunkKey(int chunkX, int chunkY);
+        static int floorDiv(int value, int divisor);
+
+        void generate(Chunk& chunk, int chunkX, int chunkY) const;
+        void evictChunks(int firstChunkX, int firstChunkY, int lastChunkX, int lastChunkY);
+
+        int m_tileSize;
+        uint32_t m_seed;
+        Generator m_generator;
+        std::vector<Decoration> m_decorations;
+        bool m_started = false;                 // Decorations are frozen once a chunk has been queued
+
+        std::unordered_map<uint64_t, std::unique_ptr<Chunk>> m_chunks;
+        JobCounter m_jobs;                      // Generation jobs still running
+    };
+
+}
+
+#endif // RUNA_GRAPHICS_PROCEDURALLAYER_H
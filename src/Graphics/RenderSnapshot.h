@@ -0,0 +1,61 @@
+// File: src/Graphics/RenderSnapshot.h
+
+/**
+ * RenderSnapshot.h
+ * Immutable per-frame render data extracted from the simulation: the camera
+ * and a flat list of sprites with their final (interpolated) transforms.
+ */
+
+#ifndef RUNA_GRAPHICS_RENDERSNAPSHOT_H
+#define RUNA_GRAPHICS_RENDERSNAPSHOT_H
+
+#include "../RunaAPI.h"
+#include <string>
+#include <vector>
+
+namespace Runa {
+
+    class Texture;
+
+    struct RUNA_API SpriteInstance {
+        const Texture* texture = nullptr;   // nullptr: untextured width x height quad
+        float x = 0.0f;                     // World-space centre
+        float y = 0.0f;
+        int srcX = 0;
+        int srcY = 0;
+        int srcWidth = 0;
+        int srcHeight = 0;
+        float width = 0.0f;                 // Untextured quads only
+        float height = 0.0f;
+        float tintR = 1.0f;
+        float tintG = 1.0f;
+        float tintB = 1.0f;
+        float tintA = 1.0f;
+        bool flipX = false;
+        bool flipY = false;
+    };
+
+    /**
+     * RenderSnapshot - Everything a pipelined scene draws, copied out of the
+     * registry at the end of a simulation frame. The render thread reads it
+     * while the simulation already advances the next frame, so it must not
+     * point into component storage.
+     */
+    struct RUNA_API RenderSnapshot {
+        float interpolationAlpha = 1.0f;    // Set before Scene::onExtract
+        float cameraX = 0.0f;
+        float cameraY = 0.0f;
+        float cameraZoom = 1.0f;
+        std::vector<SpriteInstance> sprites;
+        std::vector<std::string> debugLines;  // Screen-space overlay text, top to bottom
+
+        // Keeps capacity, so steady-state extraction doesn't allocate
+        void clear() {
+            sprites.clear();
+            debugLines.clear();
+        }
+    };
+
+}
+
+#endif // RUNA_GRAPHICS_RENDERSNAPSHOT_H
@@ -2,11 +2,18 @@
 
 #include "Renderer.h"
 #include "../runapch.h"
+#include "Camera.h"
 #include "Core/Log.h"
 
 namespace Runa {
 
-Renderer::Renderer(Window &window) : m_window(window) {
+Renderer::Renderer(Window &window)
+    : m_window(window), m_headless(window.isHeadless()) {
+
+  if (m_headless) {
+    LOG_INFO("Renderer initialized without GPU (headless)");
+    return;
+  }
 
   VK2DRendererConfig config = {};
   config.msaa = VK2D_MSAA_1X;
@@ -40,15 +47,48 @@ Renderer::~Renderer() {
 }
 
 void Renderer::beginFrame() {
+  m_frameCount++;
+  if (m_headless) {
+    return;
+  }
+
+  // Set before the frame starts, so it is picked up without a mid-frame refresh
+  setCamera(nullptr);
 
   vec4 clearColorArray = {m_clearColor.r, m_clearColor.g, m_clearColor.b, m_clearColor.a};
   vk2dRendererStartFrame(clearColorArray);
 }
 
 void Renderer::endFrame() {
+  if (m_headless) {
+    return;
+  }
   vk2dRendererEndFrame();
 }
 
+void Renderer::setCamera(const Camera *camera) {
+  if (m_headless) {
+    return;
+  }
+
+  const float width = static_cast<float>(m_window.getWidth());
+  const float height = static_cast<float>(m_window.getHeight());
+  VK2DCameraSpec spec = {};
+  spec.type = VK2D_CAMERA_TYPE_DEFAULT;
+  spec.w = width;
+  spec.h = height;
+  spec.zoom = 1.0f;
+
+  // VK2D centres the view on (x + w/2, y + h/2) and fits w/zoom by h/zoom world
+  // units to the window, the same mapping as Camera::worldToScreen minus the rounding
+  if (camera) {
+    spec.x = camera->getX() - width * 0.5f;
+    spec.y = camera->getY() - height * 0.5f;
+    spec.zoom = camera->getZoom();
+  }
+  vk2dRendererSetCamera(spec);
+}
+
 void Renderer::clear(float r, float g, float b, float a) {
 
   m_clearColor.r = r;
@@ -10,6 +10,8 @@
 
 namespace Runa {
 
+class Camera;
+
 class RUNA_API Renderer {
 public:
   explicit Renderer(Window &window);
@@ -26,12 +28,21 @@ public:
 
   VK2DRenderer getVK2DRenderer() const { return m_vk2dRenderer; }
   bool isValid() const { return m_vk2dRenderer != nullptr; }
+
+  // Null renderer for a headless window: no GPU, frames are only counted
+  bool isHeadless() const { return m_headless; }
+  uint64_t getFrameCount() const { return m_frameCount; }
   Window &getWindow() { return m_window; }
 
   void beginFrame();
   void endFrame();
   void clear(float r, float g, float b, float a);
 
+  // Transform for everything drawn after this call: world units through the
+  // camera's position and zoom on the GPU, or window pixels for nullptr (what
+  // every frame starts with). Takes effect mid-frame; pending batches keep the old one
+  void setCamera(const Camera *camera);
+
 
   struct ClearColor {
     float r = 0.0f, g = 0.0f, b = 0.0f, a = 1.0f;
@@ -42,6 +53,8 @@ private:
   Window &m_window;
   VK2DRenderer m_vk2dRenderer = nullptr;
   ClearColor m_clearColor{0.05f, 0.05f, 0.1f, 1.0f};
+  bool m_headless = false;
+  uint64_t m_frameCount = 0;
 };
 
 }
@@ -2,34 +2,75 @@
 
 #include "SpriteBatch.h"
 #include "../runapch.h"
+#include "Core/JobSystem.h"
 #include "Core/Log.h"
 #include "Renderer.h"
 
 namespace Runa {
 
+// Grows past this on demand; enough for a screen of tiles without reallocating
+static constexpr size_t INITIAL_COMMAND_CAPACITY = 4096;
+
+// Maps a float to a uint32 with the same ordering (negatives included)
+static uint32_t orderedFloatBits(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+}
+
+static uint64_t makeSortKey(uint8_t layer, float depth, VK2DBlendMode blendMode, uint32_t textureIndex) {
+    return (static_cast<uint64_t>(layer) << 56) |
+           (static_cast<uint64_t>(orderedFloatBits(depth)) << 24) |
+           (static_cast<uint64_t>(blendMode & 0xF) << 20) |
+           static_cast<uint64_t>(textureIndex & 0xFFFFF);
+}
+
+static VK2DBlendMode sortKeyBlendMode(uint64_t key) {
+    return static_cast<VK2DBlendMode>((key >> 20) & 0xF);
+}
+
 float SpriteBatch::s_pixelScale = PixelScale::getScale();
+uint64_t SpriteBatch::s_totalDrawCount = 0;
 
-SpriteBatch::SpriteBatch(Renderer &renderer) : m_renderer(renderer) {
+SpriteBatch::SpriteBatch(Renderer &renderer)
+    : m_renderer(renderer), m_headless(renderer.isHeadless()) {
     // Sync with PixelScale system
     s_pixelScale = PixelScale::getScale();
-    LOG_INFO("SpriteBatch created (using Vulkan2D internal batching, pixel scale: {})", s_pixelScale);
+    m_main.m_commands.reserve(INITIAL_COMMAND_CAPACITY);
+    m_main.m_keys.reserve(INITIAL_COMMAND_CAPACITY);
+    LOG_INFO("SpriteBatch created (CPU-side command batching, pixel scale: {})", s_pixelScale);
 }
 
 SpriteBatch::~SpriteBatch() {
 
 }
 
-void SpriteBatch::begin() {
+void SpriteBatch::begin(SortMode sortMode, const Camera *camera) {
     if (m_inBatch) {
         LOG_WARN("SpriteBatch::begin() called while already in batch!");
         return;
     }
     m_inBatch = true;
+    m_drawCount = 0;
+    m_openSubBatches = 0;
+    m_main.m_commands.clear();
+    m_main.m_keys.clear();
+    m_main.m_lastTexture = nullptr;
+    m_sortMode = sortMode;
+    m_camera = camera;
+    m_main.m_scale = camera ? 1.0f : s_pixelScale;
+    m_main.m_layer = LAYER_WORLD;
+    m_main.m_autoDepth = true;
 
-
+    // Tints multiply the renderer's colour mod, as vk2dRendererDrawTexture would apply it
+    m_main.m_blendMode = VK2D_BLEND_MODE_BLEND;
+    if (!m_headless) {
+        vk2dRendererGetColourMod(m_main.m_colourMod);
+        m_main.m_blendMode = vk2dRendererGetBlendMode();
+    }
 }
 
-void SpriteBatch::draw(const Texture &texture, int x, int y, int srcX, int srcY,
+void SpriteBatch::draw(const Texture &texture, float x, float y, int srcX, int srcY,
                        int srcWidth, int srcHeight, float r, float g, float b,
                        float a, float scaleX, float scaleY, bool flipX, bool flipY) {
     if (!m_inBatch) {
@@ -41,66 +82,189 @@ void SpriteBatch::draw(const Texture &texture, int x, int y, int srcX, int srcY,
         return;
     }
 
-    // Apply pixel scale
-    float finalScaleX = scaleX * s_pixelScale;
-    float finalScaleY = scaleY * s_pixelScale;
+    m_drawCount++;
+    s_totalDrawCount++;
+    m_main.draw(texture, x, y, srcX, srcY, srcWidth, srcHeight, r, g, b, a, scaleX, scaleY, flipX, flipY);
+}
 
-    float drawX = static_cast<float>(x);
-    float drawY = static_cast<float>(y);
+void SpriteBatch::draw(const Texture &texture, float x, float y,
+                       const SpriteFrame &frame, float r, float g, float b,
+                       float a, float scaleX, float scaleY, bool flipX, bool flipY) {
+    draw(texture, x, y, frame.x, frame.y, frame.width, frame.height, r, g, b, a,
+         scaleX, scaleY, flipX, flipY);
+}
+
+void SpriteBatch::draw(const Texture &texture, float x, float y, float r, float g,
+                       float b, float a, float scaleX, float scaleY, bool flipX, bool flipY) {
+    draw(texture, x, y, 0, 0, texture.getWidth(), texture.getHeight(), r, g, b, a,
+         scaleX, scaleY, flipX, flipY);
+}
+
+VK2DDrawCommand *SpriteBatch::appendCommands(const Texture &texture, size_t count, float depth) {
+    if (!m_inBatch) {
+        LOG_WARN("SpriteBatch::appendCommands() called outside of begin/end!");
+        return nullptr;
+    }
+
+    if (!texture.isValid() || count == 0) {
+        return nullptr;
+    }
+
+    m_drawCount += static_cast<uint32_t>(count);
+    s_totalDrawCount += count;
+    return m_main.appendCommands(texture, count, depth);
+}
+
+std::span<SpriteBatch::SubBatch> SpriteBatch::beginSubBatches(size_t count) {
+    if (!m_inBatch) {
+        LOG_WARN("SpriteBatch::beginSubBatches() called outside of begin/end!");
+        return {};
+    }
+
+    mergeSubBatches();
+    if (m_subBatches.size() < count) {
+        m_subBatches.resize(count);
+    }
+    for (size_t i = 0; i < count; ++i) {
+        m_subBatches[i].reset(m_main);
+    }
+    m_openSubBatches = count;
+    return std::span<SubBatch>(m_subBatches.data(), count);
+}
+
+void SpriteBatch::mergeSubBatches() {
+    if (m_openSubBatches == 0) {
+        return;
+    }
+
+    const size_t base = m_main.m_commands.size();
+    size_t total = 0;
+    std::vector<size_t> offsets(m_openSubBatches);
+    for (size_t i = 0; i < m_openSubBatches; ++i) {
+        offsets[i] = base + total;
+        total += m_subBatches[i].m_commands.size();
+    }
+
+    m_main.m_commands.resize(base + total);
+    m_main.m_keys.resize(base + total);
+    JobSystem::parallelFor(m_openSubBatches, 1, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            const SubBatch &sub = m_subBatches[i];
+            std::copy(sub.m_commands.begin(), sub.m_commands.end(), m_main.m_commands.begin() + offsets[i]);
+            std::copy(sub.m_keys.begin(), sub.m_keys.end(), m_main.m_keys.begin() + offsets[i]);
+        }
+    });
+
+    // The sub-batches' textures are unknown here; look the next one up again
+    m_main.m_lastTexture = nullptr;
+    m_drawCount += static_cast<uint32_t>(total);
+    s_totalDrawCount += total;
+    m_openSubBatches = 0;
+}
+
+void SpriteBatch::SubBatch::reset(const SubBatch &state) {
+    m_commands.clear();
+    m_keys.clear();
+    m_lastTexture = nullptr;
+    m_colourMod[0] = state.m_colourMod[0];
+    m_colourMod[1] = state.m_colourMod[1];
+    m_colourMod[2] = state.m_colourMod[2];
+    m_colourMod[3] = state.m_colourMod[3];
+    m_scale = state.m_scale;
+    m_layer = state.m_layer;
+    m_depth = state.m_depth;
+    m_autoDepth = state.m_autoDepth;
+    m_blendMode = state.m_blendMode;
+}
+
+// Consecutive draws usually share a texture; headless textures have no handle
+void SpriteBatch::SubBatch::updateTexture(const Texture &texture) {
+    VK2DTexture handle = texture.getHandle();
+    if (handle != m_lastTexture) {
+        m_lastTexture = handle;
+        m_lastTextureIndex = handle ? vk2dTextureGetID(handle) : 0;
+    }
+}
+
+void SpriteBatch::SubBatch::draw(const Texture &texture, float x, float y, int srcX, int srcY,
+                                 int srcWidth, int srcHeight, float r, float g, float b,
+                                 float a, float scaleX, float scaleY, bool flipX, bool flipY) {
+    if (!texture.isValid()) {
+        return;
+    }
+
+    // Apply pixel scale (1 in world space, where the camera zoom scales instead)
+    float finalScaleX = scaleX * m_scale;
+    float finalScaleY = scaleY * m_scale;
+
+    float drawX = x;
+    float drawY = y;
 
     // Handle flip by shifting position and negating scale
     // With negative scale, sprite draws to the LEFT of drawX instead of right
     // To keep the same visual position, shift drawX right by the rendered width
     if (flipX) {
-        drawX += srcWidth * s_pixelScale * scaleX;  // Shift by rendered width
+        drawX += srcWidth * m_scale * scaleX;  // Shift by rendered width
         finalScaleX = -finalScaleX;
     }
 
     if (flipY) {
-        drawY += srcHeight * s_pixelScale * scaleY;  // Shift by rendered height
+        drawY += srcHeight * m_scale * scaleY;  // Shift by rendered height
         finalScaleY = -finalScaleY;
     }
 
-    vk2dRendererDrawTexture(
-        texture.getHandle(),
-        drawX,
-        drawY,
-        finalScaleX,
-        finalScaleY,
-        0.0f,
-        0.0f,  // Keep origin at top-left
-        0.0f,
-        static_cast<float>(srcX),
-        static_cast<float>(srcY),
-        static_cast<float>(srcWidth),
-        static_cast<float>(srcHeight)
-    );
-
+    updateTexture(texture);
 
-    if (r != 1.0f || g != 1.0f || b != 1.0f || a != 1.0f) {
+    VK2DDrawCommand &command = m_commands.emplace_back();
+    command.texturePos[0] = static_cast<float>(srcX);
+    command.texturePos[1] = static_cast<float>(srcY);
+    command.texturePos[2] = static_cast<float>(srcWidth);
+    command.texturePos[3] = static_cast<float>(srcHeight);
+    command.colour[0] = r * m_colourMod[0];
+    command.colour[1] = g * m_colourMod[1];
+    command.colour[2] = b * m_colourMod[2];
+    command.colour[3] = a * m_colourMod[3];
+    command.pos[0] = drawX;
+    command.pos[1] = drawY;
+    command.origin[0] = 0.0f;  // Keep origin at top-left
+    command.origin[1] = 0.0f;
+    command.scale[0] = finalScaleX;
+    command.scale[1] = finalScaleY;
+    command.rotation = 0.0f;
+    command.textureIndex = m_lastTextureIndex;
 
-
-
-
-        static bool warnedOnce = false;
-        if (!warnedOnce) {
-            LOG_WARN("Per-sprite color tinting not yet implemented with Vulkan2D");
-            warnedOnce = true;
-        }
-    }
+    // Auto depth is the unflipped bottom edge, so flipping doesn't change the order
+    const float depth = m_autoDepth ? y + srcHeight * m_scale * scaleY : m_depth;
+    m_keys.push_back(makeSortKey(m_layer, depth, m_blendMode, m_lastTextureIndex));
 }
 
-void SpriteBatch::draw(const Texture &texture, int x, int y,
-                       const SpriteFrame &frame, float r, float g, float b,
-                       float a, float scaleX, float scaleY, bool flipX, bool flipY) {
+void SpriteBatch::SubBatch::draw(const Texture &texture, float x, float y,
+                                 const SpriteFrame &frame, float r, float g, float b,
+                                 float a, float scaleX, float scaleY, bool flipX, bool flipY) {
     draw(texture, x, y, frame.x, frame.y, frame.width, frame.height, r, g, b, a,
          scaleX, scaleY, flipX, flipY);
 }
 
-void SpriteBatch::draw(const Texture &texture, int x, int y, float r, float g,
-                       float b, float a, float scaleX, float scaleY, bool flipX, bool flipY) {
-    draw(texture, x, y, 0, 0, texture.getWidth(), texture.getHeight(), r, g, b, a,
-         scaleX, scaleY, flipX, flipY);
+VK2DDrawCommand *SpriteBatch::SubBatch::appendCommands(const Texture &texture, size_t count, float depth) {
+    if (!texture.isValid() || count == 0) {
+        return nullptr;
+    }
+
+    updateTexture(texture);
+
+    VK2DDrawCommand prototype{};
+    prototype.colour[0] = m_colourMod[0];
+    prototype.colour[1] = m_colourMod[1];
+    prototype.colour[2] = m_colourMod[2];
+    prototype.colour[3] = m_colourMod[3];
+    prototype.scale[0] = m_scale;
+    prototype.scale[1] = m_scale;
+    prototype.textureIndex = m_lastTextureIndex;
+
+    const size_t first = m_commands.size();
+    m_commands.resize(first + count, prototype);
+    m_keys.resize(m_keys.size() + count, makeSortKey(m_layer, depth, m_blendMode, m_lastTextureIndex));
+    return m_commands.data() + first;
 }
 
 void SpriteBatch::end() {
@@ -109,10 +273,113 @@ void SpriteBatch::end() {
         return;
     }
 
+    mergeSubBatches();
     m_inBatch = false;
 
+    // Null batch: commands are built and sorted (so headless runs measure the CPU
+    // cost) but never submitted
+    if (!m_main.m_commands.empty()) {
+        const VK2DDrawCommand *commands = m_main.m_commands.data();
+        const SortEntry *order = nullptr;
+        if (m_sortMode == SortMode::Sorted) {
+            sortCommands();
+            commands = m_sortedCommands.data();
+            order = m_sortEntries.data();
+        }
+
+        if (!m_headless) {
+            // World-space batches go out under their camera, then the frame is back in screen pixels
+            if (m_camera) {
+                m_renderer.setCamera(m_camera);
+            }
+            submit(commands, m_main.m_commands.size(), order);
+            if (m_camera) {
+                m_renderer.setCamera(nullptr);
+            }
+        }
+    }
+    m_main.m_commands.clear();
+    m_main.m_keys.clear();
+}
+
+// LSD radix sort of (key, index) pairs, 8 bits per pass. All histograms are built
+// in one read of the keys, and passes whose digit is the same for every key (unused
+// layers, a single blend mode, ...) are skipped. Commands are gathered once at the end
+void SpriteBatch::sortCommands() {
+    const size_t count = m_main.m_commands.size();
+    m_sortEntries.resize(count);
+    m_sortScratch.resize(count);
+
+    size_t histograms[8][256] = {};
+    for (size_t i = 0; i < count; ++i) {
+        const uint64_t key = m_main.m_keys[i];
+        m_sortEntries[i] = {key, static_cast<uint32_t>(i)};
+        for (int pass = 0; pass < 8; ++pass) {
+            histograms[pass][(key >> (pass * 8)) & 0xFF]++;
+        }
+    }
+
+    SortEntry *source = m_sortEntries.data();
+    SortEntry *target = m_sortScratch.data();
+    for (int pass = 0; pass < 8; ++pass) {
+        const size_t *histogram = histograms[pass];
+        const int shift = pass * 8;
+        if (histogram[(source[0].key >> shift) & 0xFF] == count) {
+            continue;
+        }
+
+        size_t offsets[256];
+        size_t total = 0;
+        for (int digit = 0; digit < 256; ++digit) {
+            offsets[digit] = total;
+            total += histogram[digit];
+        }
+
+        for (size_t i = 0; i < count; ++i) {
+            target[offsets[(source[i].key >> shift) & 0xFF]++] = source[i];
+        }
+        std::swap(source, target);
+    }
+
+    if (source != m_sortEntries.data()) {
+        m_sortEntries.swap(m_sortScratch);
+    }
+
+    m_sortedCommands.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        m_sortedCommands[i] = m_main.m_commands[m_sortEntries[i].index];
+    }
+}
+
+// One vk2dRendererAddBatch per run of equal blend mode; the renderer's mode is restored after
+void SpriteBatch::submit(const VK2DDrawCommand *commands, size_t count, const SortEntry *order) {
+    auto blendModeAt = [&](size_t i) {
+        return sortKeyBlendMode(order ? order[i].key : m_main.m_keys[i]);
+    };
 
+    const VK2DBlendMode previous = vk2dRendererGetBlendMode();
+    VK2DBlendMode current = previous;
 
+    size_t runStart = 0;
+    while (runStart < count) {
+        const VK2DBlendMode blendMode = blendModeAt(runStart);
+        size_t runEnd = runStart + 1;
+        while (runEnd < count && blendModeAt(runEnd) == blendMode) {
+            runEnd++;
+        }
+
+        if (blendMode != current) {
+            vk2dRendererSetBlendMode(blendMode);
+            current = blendMode;
+        }
+        vk2dRendererAddBatch(const_cast<VK2DDrawCommand *>(commands + runStart),
+                             static_cast<uint32_t>(runEnd - runStart));
+        runStart = runEnd;
+    }
+
+    if (current != previous) {
+        vk2dRendererSetBlendMode(previous);
+    }
 }
 
 }
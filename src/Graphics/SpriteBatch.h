@@ -8,10 +8,14 @@
 #include "SpriteSheet.h"
 #include "PixelScale.h"
 #include <VK2D/VK2D.h>
+#include <cstdint>
+#include <span>
+#include <vector>
 
 namespace Runa
 {
 
+    class Camera;
     class Renderer;
 
     
@@ -26,6 +30,66 @@ namespace Runa
             float r, g, b, a; 
         };
 
+        // Submission: draw in call order. Sorted: radix-sort by layer, then depth,
+        // then blend mode and texture (stable, so ties keep call order)
+        enum class SortMode
+        {
+            Submission,
+            Sorted
+        };
+
+        // Common layers for sorted batches; any 0-255 value works
+        static constexpr uint8_t LAYER_GROUND = 0;
+        static constexpr uint8_t LAYER_WORLD = 128;
+        static constexpr uint8_t LAYER_UI = 255;
+
+        /**
+         * SubBatch - Draw recorder for one thread. Get them from beginSubBatches(),
+         * fill each on its own thread, and the batch merges them in index order, so
+         * the result is identical to making the same draws on the batch serially.
+         * Same drawing calls as SpriteBatch; nothing here touches the renderer.
+         */
+        class RUNA_API SubBatch
+        {
+        public:
+            void setLayer(uint8_t layer) { m_layer = layer; m_autoDepth = true; }
+            void setLayer(uint8_t layer, float depth) { m_layer = layer; m_depth = depth; m_autoDepth = false; }
+            void setBlendMode(VK2DBlendMode blendMode) { m_blendMode = blendMode; }
+
+            void draw(const Texture &texture, float x, float y, int srcX, int srcY,
+                      int srcWidth, int srcHeight,
+                      float r = 1.0f, float g = 1.0f, float b = 1.0f, float a = 1.0f,
+                      float scaleX = 1.0f, float scaleY = 1.0f,
+                      bool flipX = false, bool flipY = false);
+
+            void draw(const Texture &texture, float x, float y, const SpriteFrame &frame,
+                      float r = 1.0f, float g = 1.0f, float b = 1.0f, float a = 1.0f,
+                      float scaleX = 1.0f, float scaleY = 1.0f,
+                      bool flipX = false, bool flipY = false);
+
+            VK2DDrawCommand *appendCommands(const Texture &texture, size_t count, float depth = 0.0f);
+
+            size_t getDrawCount() const { return m_commands.size(); }
+
+        private:
+            friend class SpriteBatch;
+
+            // Starts empty with the owning batch's current state
+            void reset(const SubBatch &state);
+            void updateTexture(const Texture &texture);
+
+            std::vector<VK2DDrawCommand> m_commands;
+            std::vector<uint64_t> m_keys;   // One sort key per command: layer (8) | depth (32) | blend mode (4) | texture (20)
+            VK2DTexture m_lastTexture = nullptr;
+            uint32_t m_lastTextureIndex = 0;
+            vec4 m_colourMod = {1.0f, 1.0f, 1.0f, 1.0f};
+            float m_scale = 1.0f;           // Applied to every sprite: the pixel scale in screen space, 1 in world space
+            uint8_t m_layer = LAYER_WORLD;
+            float m_depth = 0.0f;
+            bool m_autoDepth = true;
+            VK2DBlendMode m_blendMode = VK2D_BLEND_MODE_BLEND;
+        };
+
         explicit SpriteBatch(Renderer &renderer);
         ~SpriteBatch();
 
@@ -35,35 +99,102 @@ namespace Runa
             PixelScale::setScale(scale);
         }
         static float getPixelScale() { return s_pixelScale; }
-        
-        void begin();
 
-        
-        void draw(const Texture &texture, int x, int y, int srcX, int srcY,
+        // Without a camera, positions are screen pixels and sprites are drawn at the
+        // pixel scale. With one, positions are world units and sprites one unit per
+        // texel; end() submits under the camera (Renderer::setCamera), so the zoom and
+        // scroll, sub-pixel included, are applied in the vertex stage. The camera is
+        // read at end() and must outlive the batch
+        void begin(SortMode sortMode = SortMode::Submission, const Camera *camera = nullptr);
+
+        // Layer for the following draws. Depth is each sprite's bottom edge,
+        // so sprites on one layer are Y-sorted
+        void setLayer(uint8_t layer) { m_main.setLayer(layer); }
+
+        // Layer and a fixed depth for the following draws (lower depth draws first)
+        void setLayer(uint8_t layer, float depth) { m_main.setLayer(layer, depth); }
+
+        // Blend mode for the following draws; runs of one mode are submitted together
+        void setBlendMode(VK2DBlendMode blendMode) { m_main.setBlendMode(blendMode); }
+
+        // r/g/b/a tint the sprite through its own draw command (times the renderer's
+        // colour mod), so tinted and untinted sprites share one batch
+        void draw(const Texture &texture, float x, float y, int srcX, int srcY,
                   int srcWidth, int srcHeight,
                   float r = 1.0f, float g = 1.0f, float b = 1.0f, float a = 1.0f,
                   float scaleX = 1.0f, float scaleY = 1.0f,
                   bool flipX = false, bool flipY = false);
 
         
-        void draw(const Texture &texture, int x, int y, const SpriteFrame &frame,
+        void draw(const Texture &texture, float x, float y, const SpriteFrame &frame,
                   float r = 1.0f, float g = 1.0f, float b = 1.0f, float a = 1.0f,
                   float scaleX = 1.0f, float scaleY = 1.0f,
                   bool flipX = false, bool flipY = false);
 
         
-        void draw(const Texture &texture, int x, int y,
+        void draw(const Texture &texture, float x, float y,
                   float r = 1.0f, float g = 1.0f, float b = 1.0f, float a = 1.0f,
                   float scaleX = 1.0f, float scaleY = 1.0f,
                   bool flipX = false, bool flipY = false);
 
+        // Appends `count` commands for one texture and returns them to be filled in place
+        // (pos and texturePos; colour, scale and texture are preset as draw() would set them).
+        // Their sort keys use the current layer and blend mode with a fixed depth.
+        // The pointer is valid until the next draw; nullptr outside begin/end
+        VK2DDrawCommand *appendCommands(const Texture &texture, size_t count, float depth = 0.0f);
+
+        // `count` empty sub-batches starting from the current layer, depth and blend mode,
+        // for filling in parallel (one thread each). Draw on the batch itself again only
+        // after mergeSubBatches(), which end() also calls
+        std::span<SubBatch> beginSubBatches(size_t count);
+
+        // Append the sub-batches in index order, copying them in parallel
+        void mergeSubBatches();
+
         
         void end();
 
+        // Draw commands issued between the last begin()/end(); counted in headless mode too
+        uint32_t getDrawCount() const { return m_drawCount; }
+
+        // Commands the batch can hold without reallocating (grows to the largest frame)
+        size_t getCommandCapacity() const { return m_main.m_commands.capacity(); }
+
+        // Draw commands issued by all batches since the last reset
+        static uint64_t getTotalDrawCount() { return s_totalDrawCount; }
+        static void resetTotalDrawCount() { s_totalDrawCount = 0; }
+
     private:
         Renderer &m_renderer;
+        const Camera *m_camera = nullptr;
         bool m_inBatch = false;
+        bool m_headless = false;
+        uint32_t m_drawCount = 0;
+
+        // Filled by draw() and handed to VK2D in one vk2dRendererAddBatch() at end().
+        // Cleared, not freed, so steady-state frames don't allocate
+        SubBatch m_main;
+
+        // Kept between frames for their capacity; the first m_openSubBatches are in use
+        std::vector<SubBatch> m_subBatches;
+        size_t m_openSubBatches = 0;
+
+        struct SortEntry
+        {
+            uint64_t key;
+            uint32_t index;
+        };
+
+        SortMode m_sortMode = SortMode::Submission;
+        std::vector<SortEntry> m_sortEntries;
+        std::vector<SortEntry> m_sortScratch;
+        std::vector<VK2DDrawCommand> m_sortedCommands;
+
+        void sortCommands();
+        void submit(const VK2DDrawCommand *commands, size_t count, const SortEntry *order);
+
         static float s_pixelScale;
+        static uint64_t s_totalDrawCount;
         
     };
 
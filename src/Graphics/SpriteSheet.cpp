@@ -29,7 +29,7 @@ void SpriteSheet::addSprite(const std::string& name, int x, int y, int width, in
     frame.duration = 0.0f;
 
     sprite.frames.push_back(frame);
-    m_sprites[name] = sprite;
+    storeSprite(name, std::move(sprite));
 
     LOG_DEBUG("Added sprite '{}' at ({},{}) size {}x{}", name, x, y, width, height);
 }
@@ -67,7 +67,7 @@ void SpriteSheet::addAnimation(const std::string& name, int x, int y, int frameW
         }
     }
 
-    m_sprites[name] = sprite;
+    storeSprite(name, std::move(sprite));
 
     LOG_DEBUG("Added animation '{}' with {} frames", name, frameCount);
 }
@@ -78,7 +78,7 @@ void SpriteSheet::addSpriteFrames(const std::string& name, const std::vector<Spr
     sprite.frames = frames;
     sprite.loop = loop;
 
-    m_sprites[name] = sprite;
+    storeSprite(name, std::move(sprite));
 
     LOG_DEBUG("Added sprite '{}' with {} frames", name, frames.size());
 }
@@ -91,6 +91,17 @@ const Sprite* SpriteSheet::getSprite(const std::string& name) const {
     return nullptr;
 }
 
+const Sprite* SpriteSheet::getSprite(StringId name) const {
+    auto it = m_spritesById.find(name);
+    return it != m_spritesById.end() ? it->second : nullptr;
+}
+
+void SpriteSheet::storeSprite(const std::string& name, Sprite&& sprite) {
+    Sprite& stored = m_sprites[name];
+    stored = std::move(sprite);
+    m_spritesById[StringPool::intern(name)] = &stored;
+}
+
 std::vector<std::string> SpriteSheet::getSpriteNames() const {
     std::vector<std::string> names;
     names.reserve(m_sprites.size());
@@ -5,6 +5,7 @@
 
 #include "RunaAPI.h"
 #include "Texture.h"
+#include "../Core/StringPool.h"
 #include <string>
 #include <vector>
 #include <unordered_map>
@@ -67,6 +68,9 @@ namespace Runa
 
 
         const Sprite *getSprite(const std::string &name) const;
+
+        // Lookup by interned name, avoids hashing the string on hot paths
+        const Sprite *getSprite(StringId name) const;
         const Texture &getTexture() const { return *m_texture; }
         
         // Get the texture path (for pixel-perfect collision mask generation)
@@ -81,6 +85,9 @@ namespace Runa
         std::unique_ptr<Texture> m_texture;
         std::string m_texturePath;  // Store path for pixel-perfect collision
         std::unordered_map<std::string, Sprite> m_sprites;
+        std::unordered_map<StringId, const Sprite *> m_spritesById;  // Points into m_sprites (node-stable)
+
+        void storeSprite(const std::string &name, Sprite &&sprite);
     };
 
 }
@@ -0,0 +1,370 @@
+// File: src/Graphics/StaticTileLayer.cpp
+
+/**
+ * StaticTileLayer.cpp
+ * Chunk bookkeeping, lazy generation, instance buffer uploads and the
+ * low-zoom render target cache.
+ */
+
+#include "../runapch.h"
+#include "StaticTileLayer.h"
+#include "Camera.h"
+#include "Renderer.h"
+#include "Core/Log.h"
+#include <cmath>
+
+namespace Runa {
+
+    StaticTileLayer::StaticTileLayer(Renderer& renderer, int tileSize)
+        : m_headless(renderer.isHeadless()), m_tileSize(std::max(1, tileSize)) {}
+
+    StaticTileLayer::~StaticTileLayer() {
+        clear();
+        // vk2dTextureFree doesn't wait for frames in flight. vk2dInstanceBufferFree waits on
+        // every call, but only the first wait has work left to wait for
+        if (!m_retiredTextures.empty()) {
+            vk2dRendererWait();
+        }
+        freeRetiredTextures(true);
+        for (VK2DInstanceBuffer buffer : m_freeBuffers) {
+            vk2dInstanceBufferFree(buffer);
+        }
+    }
+
+    uint64_t StaticTileLayer::chunkKey(int chunkX, int chunkY) {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(chunkX)) << 32) | static_cast<uint32_t>(chunkY);
+    }
+
+    // Rounds towards negative infinity, so tile -1 lands in chunk -1
+    int StaticTileLayer::floorDiv(int value, int divisor) {
+        int quotient = value / divisor;
+        if ((value % divisor != 0) && ((value < 0) != (divisor < 0))) {
+            quotient--;
+        }
+        return quotient;
+    }
+
+    // -1 draws the instance buffer directly; otherwise the largest level whose
+    // target is still at least as large as the chunk on screen
+    int StaticTileLayer::cacheLevel(float zoom) {
+        if (zoom >= 1.0f) {
+            return -1;
+        }
+        const int level = static_cast<int>(std::floor(std::log2(1.0f / zoom)));
+        return std::clamp(level, 0, CACHE_LEVELS - 1);
+    }
+
+    // Colour, resolve and depth images of a vk2dTextureCreate target
+    size_t StaticTileLayer::cacheTextureBytes(int size) {
+        return static_cast<size_t>(size) * static_cast<size_t>(size) * 4 * 3;
+    }
+
+    StaticTileLayer::Chunk* StaticTileLayer::findChunk(int chunkX, int chunkY) {
+        auto it = m_chunks.find(chunkKey(chunkX, chunkY));
+        return it != m_chunks.end() ? it->second.get() : nullptr;
+    }
+
+    StaticTileLayer::Chunk& StaticTileLayer::getChunk(int chunkX, int chunkY) {
+        if (Chunk* chunk = findChunk(chunkX, chunkY)) {
+            return *chunk;
+        }
+
+        auto& slot = m_chunks[chunkKey(chunkX, chunkY)];
+        slot = std::make_unique<Chunk>();
+        Chunk& chunk = *slot;
+
+        // Inserted before generating, so the generator's addSprite() calls find it
+        if (m_generator && !m_generating) {
+            m_generating = true;
+            m_generator(*this, chunkX * CHUNK_TILES, chunkY * CHUNK_TILES);
+            m_generating = false;
+        }
+        return chunk;
+    }
+
+    void StaticTileLayer::addSprite(int tileX, int tileY, const Texture& texture, const SpriteFrame& frame) {
+        if (!texture.isValid()) {
+            return;
+        }
+
+        const int chunkX = floorDiv(tileX, CHUNK_TILES);
+        const int chunkY = floorDiv(tileY, CHUNK_TILES);
+        Chunk& chunk = getChunk(chunkX, chunkY);
+
+        const int localX = tileX - chunkX * CHUNK_TILES;
+        const int localY = tileY - chunkY * CHUNK_TILES;
+
+        VK2DDrawCommand command{};
+        command.texturePos[0] = static_cast<float>(frame.x);
+        command.texturePos[1] = static_cast<float>(frame.y);
+        command.texturePos[2] = static_cast<float>(frame.width);
+        command.texturePos[3] = static_cast<float>(frame.height);
+        command.colour[0] = command.colour[1] = command.colour[2] = command.colour[3] = 1.0f;
+        command.pos[0] = static_cast<float>(tileX * m_tileSize);
+        command.pos[1] = static_cast<float>(tileY * m_tileSize);
+        command.scale[0] = 1.0f;
+        command.scale[1] = 1.0f;
+        command.textureIndex = texture.getHandle() ? vk2dTextureGetID(texture.getHandle()) : 0;
+
+        chunk.commands.push_back(command);
+        chunk.tiles.push_back(static_cast<uint16_t>(localY * CHUNK_TILES + localX));
+        chunk.dirty = true;
+        invalidateCache(chunk);
+        chunk.edited |= !m_generating;
+    }
+
+    void StaticTileLayer::clearTile(int tileX, int tileY) {
+        const int chunkX = floorDiv(tileX, CHUNK_TILES);
+        const int chunkY = floorDiv(tileY, CHUNK_TILES);
+        Chunk& chunk = getChunk(chunkX, chunkY);
+
+        const uint16_t tile = static_cast<uint16_t>((tileY - chunkY * CHUNK_TILES) * CHUNK_TILES +
+                                                    (tileX - chunkX * CHUNK_TILES));
+
+        size_t kept = 0;
+        for (size_t i = 0; i < chunk.commands.size(); ++i) {
+            if (chunk.tiles[i] != tile) {
+                chunk.commands[kept] = chunk.commands[i];
+                chunk.tiles[kept] = chunk.tiles[i];
+                kept++;
+            }
+        }
+
+        if (kept != chunk.commands.size()) {
+            chunk.commands.resize(kept);
+            chunk.tiles.resize(kept);
+            chunk.dirty = true;
+            invalidateCache(chunk);
+        }
+        chunk.edited |= !m_generating;
+    }
+
+    void StaticTileLayer::clear() {
+        for (auto& [key, chunk] : m_chunks) {
+            invalidateCache(*chunk);
+            if (chunk->buffer) {
+                m_freeBuffers.push_back(chunk->buffer);
+            }
+        }
+        m_chunks.clear();
+    }
+
+    void StaticTileLayer::uploadChunk(Chunk& chunk) {
+        if (!m_headless) {
+            const auto count = static_cast<uint32_t>(chunk.commands.size());
+            if (!chunk.buffer) {
+                chunk.buffer = takeFreeBuffer(count);
+            }
+            if (!chunk.buffer) {
+                // Sized for a full chunk so the buffer fits any chunk once it is recycled
+                chunk.buffer = vk2dInstanceBufferCreate(std::max<uint32_t>(count, CHUNK_TILES * CHUNK_TILES));
+            }
+            if (chunk.buffer) {
+                vk2dInstanceBufferUpdate(chunk.buffer, chunk.commands.data(), count);
+            }
+        }
+        chunk.dirty = false;
+    }
+
+    // Smallest free buffer that holds count commands, or nullptr
+    VK2DInstanceBuffer StaticTileLayer::takeFreeBuffer(uint32_t count) {
+        auto best = m_freeBuffers.end();
+        for (auto it = m_freeBuffers.begin(); it != m_freeBuffers.end(); ++it) {
+            uint32_t capacity = vk2dInstanceBufferGetCapacity(*it);
+            if (capacity >= count && (best == m_freeBuffers.end() || capacity < vk2dInstanceBufferGetCapacity(*best))) {
+                best = it;
+            }
+        }
+        if (best == m_freeBuffers.end()) {
+            return nullptr;
+        }
+
+        VK2DInstanceBuffer buffer = *best;
+        *best = m_freeBuffers.back();
+        m_freeBuffers.pop_back();
+        return buffer;
+    }
+
+    void StaticTileLayer::draw(const Camera& camera) {
+        m_frame++;
+        m_drawnChunks = 0;
+        freeRetiredTextures(false);
+
+        const auto bounds = camera.getWorldBounds();
+        const int chunkPixels = CHUNK_TILES * m_tileSize;
+        const int firstChunkX = floorDiv(static_cast<int>(std::floor(bounds.left)), chunkPixels);
+        const int firstChunkY = floorDiv(static_cast<int>(std::floor(bounds.top)), chunkPixels);
+        const int lastChunkX = floorDiv(static_cast<int>(std::ceil(bounds.right)), chunkPixels);
+        const int lastChunkY = floorDiv(static_cast<int>(std::ceil(bounds.bottom)), chunkPixels);
+
+        // Same mapping as Camera::worldToScreen, applied on the GPU; whole pixels keep tiles seamless
+        const float zoom = camera.getZoom();
+        int originX, originY;
+        camera.worldToScreen(0.0f, 0.0f, originX, originY);
+
+        const int level = (m_headless || m_cacheBudget == 0) ? -1 : cacheLevel(zoom);
+        int rastersLeft = MAX_RASTERS_PER_FRAME;
+
+        for (int chunkY = firstChunkY; chunkY <= lastChunkY; ++chunkY) {
+            for (int chunkX = firstChunkX; chunkX <= lastChunkX; ++chunkX) {
+                Chunk* chunk = m_generator ? &getChunk(chunkX, chunkY) : findChunk(chunkX, chunkY);
+                if (!chunk) {
+                    continue;
+                }
+
+                chunk->lastDrawnFrame = m_frame;
+                if (chunk->commands.empty()) {
+                    continue;
+                }
+
+                if (chunk->dirty) {
+                    uploadChunk(*chunk);
+                }
+                VK2DTexture cached = nullptr;
+                if (chunk->buffer && level >= 0) {
+                    cached = getCachedTexture(*chunk, chunkX, chunkY, level, rastersLeft);
+                }
+
+                if (cached) {
+                    // Edges rounded per chunk rather than per size, so neighbours meet without gaps
+                    const float left = std::round(originX + chunkX * chunkPixels * zoom);
+                    const float top = std::round(originY + chunkY * chunkPixels * zoom);
+                    const float right = std::round(originX + (chunkX + 1) * chunkPixels * zoom);
+                    const float bottom = std::round(originY + (chunkY + 1) * chunkPixels * zoom);
+                    const float size = vk2dTextureWidth(cached);
+                    vk2dRendererDrawTexture(cached, left, top, (right - left) / size, (bottom - top) / size,
+                                            0, 0, 0, 0, 0, size, size);
+                } else if (chunk->buffer) {
+                    vk2dRendererDrawInstanceBuffer(chunk->buffer, static_cast<float>(originX),
+                                                   static_cast<float>(originY), zoom);
+                }
+                m_drawnChunks++;
+            }
+        }
+
+        if (m_generator && m_chunks.size() > MAX_CACHED_CHUNKS) {
+            evictChunks();
+        }
+    }
+
+    // Drops the least recently drawn generated chunks down to 3/4 of the cap;
+    // their buffers are kept for reuse
+    void StaticTileLayer::evictChunks() {
+        std::vector<std::pair<uint64_t, uint64_t>> candidates;   // (lastDrawnFrame, key)
+        for (const auto& [key, chunk] : m_chunks) {
+            if (!chunk->edited && chunk->lastDrawnFrame != m_frame) {
+                candidates.emplace_back(chunk->lastDrawnFrame, key);
+            }
+        }
+        std::sort(candidates.begin(), candidates.end());
+
+        const size_t target = MAX_CACHED_CHUNKS * 3 / 4;
+        size_t evicted = 0;
+        for (const auto& [lastDrawn, key] : candidates) {
+            if (m_chunks.size() <= target) {
+                break;
+            }
+            auto it = m_chunks.find(key);
+            invalidateCache(*it->second);
+            if (it->second->buffer) {
+                m_freeBuffers.push_back(it->second->buffer);
+            }
+            m_chunks.erase(it);
+            evicted++;
+        }
+
+        LOG_DEBUG("StaticTileLayer: Evicted {} chunks ({} cached)", evicted, m_chunks.size());
+    }
+
+    // Returns the chunk's target for this level, rasterising it if there is
+    // room in the budget and in this frame's raster allowance
+    VK2DTexture StaticTileLayer::getCachedTexture(Chunk& chunk, int chunkX, int chunkY, int level,
+                                                  int& rastersLeft) {
+        CachedTexture& slot = chunk.cached[level];
+        if (slot.texture) {
+            slot.lru->lastUsedFrame = m_frame;
+            m_cacheLru.splice(m_cacheLru.begin(), m_cacheLru, slot.lru);
+            return slot.texture;
+        }
+
+        const int chunkPixels = CHUNK_TILES * m_tileSize;
+        const int size = std::max(1, chunkPixels >> level);
+        const size_t bytes = cacheTextureBytes(size);
+        if (rastersLeft <= 0 || !makeCacheRoom(bytes)) {
+            return nullptr;
+        }
+
+        VK2DTexture texture = vk2dTextureCreate(static_cast<float>(size), static_cast<float>(size));
+        if (!texture) {
+            LOG_WARN("StaticTileLayer: Failed to create {}x{} chunk cache target", size, size);
+            return nullptr;
+        }
+
+        // Texture targets draw in texture space, so shift the chunk's corner to the origin
+        const float scale = static_cast<float>(size) / static_cast<float>(chunkPixels);
+        vk2dRendererSetTarget(texture);
+        vk2dRendererEmpty();
+        vk2dRendererDrawInstanceBuffer(chunk.buffer, -static_cast<float>(chunkX * chunkPixels) * scale,
+                                       -static_cast<float>(chunkY * chunkPixels) * scale, scale);
+        vk2dRendererSetTarget(VK2D_TARGET_SCREEN);
+
+        m_cacheLru.push_front(CacheEntry{&chunk, level, m_frame});
+        slot.texture = texture;
+        slot.lru = m_cacheLru.begin();
+        m_cachedBytes += bytes;
+        rastersLeft--;
+        return texture;
+    }
+
+    // The GPU may still be sampling the target, so it is freed a few frames later
+    void StaticTileLayer::releaseCachedTexture(Chunk& chunk, int level) {
+        CachedTexture& slot = chunk.cached[level];
+        if (!slot.texture) {
+            return;
+        }
+
+        const int size = static_cast<int>(vk2dTextureWidth(slot.texture));
+        m_cachedBytes -= std::min(m_cachedBytes, cacheTextureBytes(size));
+        m_retiredTextures.emplace_back(slot.texture, m_frame);
+        m_cacheLru.erase(slot.lru);
+        slot = CachedTexture{};
+    }
+
+    void StaticTileLayer::invalidateCache(Chunk& chunk) {
+        for (int level = 0; level < CACHE_LEVELS; ++level) {
+            releaseCachedTexture(chunk, level);
+        }
+    }
+
+    // Evicts least recently drawn targets until `bytes` more fit the budget;
+    // never evicts a target drawn this frame, so a view larger than the budget
+    // does not thrash
+    bool StaticTileLayer::makeCacheRoom(size_t bytes) {
+        while (m_cachedBytes + bytes > m_cacheBudget && !m_cacheLru.empty()) {
+            const CacheEntry& oldest = m_cacheLru.back();
+            if (oldest.lastUsedFrame == m_frame) {
+                break;
+            }
+            releaseCachedTexture(*oldest.chunk, oldest.level);
+        }
+        return m_cachedBytes + bytes <= m_cacheBudget;
+    }
+
+    void StaticTileLayer::setCacheBudget(size_t bytes) {
+        m_cacheBudget = bytes;
+        makeCacheRoom(0);
+    }
+
+    void StaticTileLayer::freeRetiredTextures(bool all) {
+        size_t kept = 0;
+        for (const auto& [texture, retiredFrame] : m_retiredTextures) {
+            if (all || m_frame - retiredFrame > VK2D_MAX_FRAMES_IN_FLIGHT) {
+                vk2dTextureFree(texture);
+            } else {
+                m_retiredTextures[kept++] = {texture, retiredFrame};
+            }
+        }
+        m_retiredTextures.resize(kept);
+    }
+
+}
@@ -0,0 +1,149 @@
+// File: src/Graphics/StaticTileLayer.h
+
+/**
+ * StaticTileLayer.h
+ * Background tiles baked per chunk into persistent VK2D instance buffers.
+ * A chunk costs one draw call a frame and is only re-uploaded when one of
+ * its tiles changes. Zoomed out, chunks are drawn from cached render targets.
+ */
+
+#ifndef RUNA_GRAPHICS_STATICTILELAYER_H
+#define RUNA_GRAPHICS_STATICTILELAYER_H
+
+#include "RunaAPI.h"
+#include "SpriteSheet.h"
+#include "Texture.h"
+#include <VK2D/VK2D.h>
+#include <cstdint>
+#include <array>
+#include <functional>
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace Runa {
+
+    class Renderer;
+    class Camera;
+
+    /**
+     * StaticTileLayer - Sprites that sit on a tile grid and rarely change.
+     * Tiles are in world space; draw() applies the camera's position and zoom
+     * on the GPU, so panning and zooming cost nothing per tile.
+     *
+     * Chunks can be filled up front with addSprite(), or lazily by a generator
+     * the first time they come into view. Generated chunks that have not been
+     * edited are evicted once too many are cached, and regenerated on demand.
+     *
+     * Below zoom 1 a chunk is rasterised once into a render target and drawn as
+     * a single quad. Each halving of the zoom uses a half-resolution target, so
+     * the pixels rasterised stay close to the pixels shown. Targets are kept in
+     * an LRU under a VRAM budget and dropped when their chunk changes.
+     */
+    class RUNA_API StaticTileLayer {
+    public:
+        static constexpr int CHUNK_TILES = 32;              // Chunk edge length in tiles
+        static constexpr size_t MAX_CACHED_CHUNKS = 256;
+        static constexpr int CACHE_LEVELS = 3;              // Full, half and quarter resolution
+        static constexpr int MAX_RASTERS_PER_FRAME = 4;     // Uncached chunks past this are drawn directly
+        static constexpr size_t DEFAULT_CACHE_BUDGET = 128ull * 1024 * 1024;
+
+        // Fills the chunk whose top-left tile is (firstTileX, firstTileY) through addSprite();
+        // must only add sprites inside that chunk
+        using ChunkGenerator = std::function<void(StaticTileLayer& layer, int firstTileX, int firstTileY)>;
+
+        StaticTileLayer(Renderer& renderer, int tileSize);
+        ~StaticTileLayer();
+
+        StaticTileLayer(const StaticTileLayer&) = delete;
+        StaticTileLayer& operator=(const StaticTileLayer&) = delete;
+
+        void setGenerator(ChunkGenerator generator) { m_generator = std::move(generator); }
+
+        // Stack a sprite on a tile, above the sprites already there
+        void addSprite(int tileX, int tileY, const Texture& texture, const SpriteFrame& frame);
+
+        // Remove every sprite on a tile
+        void clearTile(int tileX, int tileY);
+
+        // Drop every chunk (generated chunks come back on the next draw)
+        void clear();
+
+        // Draw the chunks the camera can see, generating and uploading them as needed
+        void draw(const Camera& camera);
+
+        // Estimated VRAM the chunk render targets may use; 0 disables the cache
+        void setCacheBudget(size_t bytes);
+
+        int getTileSize() const { return m_tileSize; }
+        size_t getChunkCount() const { return m_chunks.size(); }
+        size_t getDrawnChunkCount() const { return m_drawnChunks; }
+        size_t getCacheBudget() const { return m_cacheBudget; }
+        size_t getCachedBytes() const { return m_cachedBytes; }
+        size_t getCachedTextureCount() const { return m_cacheLru.size(); }
+
+    private:
+        struct Chunk;
+
+        struct CacheEntry {
+            Chunk* chunk;
+            int level;
+            uint64_t lastUsedFrame;
+        };
+
+        struct CachedTexture {
+            VK2DTexture texture = nullptr;
+            std::list<CacheEntry>::iterator lru;
+        };
+
+        struct Chunk {
+            std::vector<VK2DDrawCommand> commands;  // World-space, in tile order
+            std::vector<uint16_t> tiles;            // Chunk-local tile index of each command
+            VK2DInstanceBuffer buffer = nullptr;
+            std::array<CachedTexture, CACHE_LEVELS> cached{};   // Render target per cache level
+            uint64_t lastDrawnFrame = 0;
+            bool dirty = true;                      // Commands changed since the last upload
+            bool edited = false;                    // Changed outside the generator; never evicted
+        };
+
+        static uint64_t chunkKey(int chunkX, int chunkY);
+        static int floorDiv(int value, int divisor);
+        static int cacheLevel(float zoom);
+        static size_t cacheTextureBytes(int size);
+
+        Chunk* findChunk(int chunkX, int chunkY);
+        Chunk& getChunk(int chunkX, int chunkY);
+        void uploadChunk(Chunk& chunk);
+        VK2DInstanceBuffer takeFreeBuffer(uint32_t count);
+        void evictChunks();
+
+        VK2DTexture getCachedTexture(Chunk& chunk, int chunkX, int chunkY, int level, int& rastersLeft);
+        void releaseCachedTexture(Chunk& chunk, int level);
+        void invalidateCache(Chunk& chunk);
+        bool makeCacheRoom(size_t bytes);
+        void freeRetiredTextures(bool all);
+
+        bool m_headless;
+        int m_tileSize;
+        ChunkGenerator m_generator;
+
+        // unique_ptr keeps a chunk in place while a generator adds to the map
+        std::unordered_map<uint64_t, std::unique_ptr<Chunk>> m_chunks;
+        // From evicted chunks. Only handed to chunks that fit in their capacity, since
+        // growing a buffer waits for the GPU
+        std::vector<VK2DInstanceBuffer> m_freeBuffers;
+        // Front is the most recently drawn; retired targets wait out the frames in flight before being freed
+        std::list<CacheEntry> m_cacheLru;
+        std::vector<std::pair<VK2DTexture, uint64_t>> m_retiredTextures;
+        size_t m_cacheBudget = DEFAULT_CACHE_BUDGET;
+        size_t m_cachedBytes = 0;
+
+        bool m_generating = false;
+        uint64_t m_frame = 0;
+        size_t m_drawnChunks = 0;
+    };
+
+}
+
+#endif // RUNA_GRAPHICS_STATICTILELAYER_H
@@ -8,6 +8,10 @@
 namespace Runa {
 
 Texture::Texture(Renderer& renderer, const std::string& path) {
+    if (renderer.isHeadless()) {
+        loadSizeFromFile(path);
+        return;
+    }
     if (!renderer.isValid()) {
         throw std::runtime_error("Invalid Vulkan2D renderer for texture creation");
     }
@@ -15,6 +19,12 @@ Texture::Texture(Renderer& renderer, const std::string& path) {
 }
 
 Texture::Texture(Renderer& renderer, int width, int height, const void* pixelData) {
+    if (renderer.isHeadless()) {
+        m_width = width;
+        m_height = height;
+        m_headless = true;
+        return;
+    }
     if (!renderer.isValid()) {
         throw std::runtime_error("Invalid Vulkan2D renderer for texture creation");
     }
@@ -30,7 +40,8 @@ Texture::~Texture() {
 Texture::Texture(Texture&& other) noexcept
     : m_texture(other.m_texture),
       m_width(other.m_width),
-      m_height(other.m_height) {
+      m_height(other.m_height),
+      m_headless(other.m_headless) {
     other.m_texture = nullptr;
     other.m_width = 0;
     other.m_height = 0;
@@ -45,6 +56,7 @@ Texture& Texture::operator=(Texture&& other) noexcept {
         m_texture = other.m_texture;
         m_width = other.m_width;
         m_height = other.m_height;
+        m_headless = other.m_headless;
 
         other.m_texture = nullptr;
         other.m_width = 0;
@@ -68,6 +80,22 @@ void Texture::loadFromFile(const std::string& path) {
     LOG_INFO("Texture loaded: {} ({}x{})", path, m_width, m_height);
 }
 
+void Texture::loadSizeFromFile(const std::string& path) {
+
+    // Decode on the CPU only to learn the size; nothing is uploaded
+    SDL_Surface* surface = IMG_Load(path.c_str());
+    if (!surface) {
+        throw std::runtime_error("Failed to load texture: " + path);
+    }
+
+    m_width = surface->w;
+    m_height = surface->h;
+    m_headless = true;
+    SDL_DestroySurface(surface);
+
+    LOG_INFO("Texture loaded (headless): {} ({}x{})", path, m_width, m_height);
+}
+
 void Texture::createFromPixels(int width, int height, const void* pixelData) {
     m_width = width;
     m_height = height;
@@ -30,7 +30,10 @@ namespace Runa
         VK2DTexture getHandle() const { return m_texture; }
         int getWidth() const { return m_width; }
         int getHeight() const { return m_height; }
-        bool isValid() const { return m_texture != nullptr; }
+        bool isValid() const { return m_texture != nullptr || m_headless; }
+
+        // Headless textures only know their size; getHandle() is nullptr
+        bool isHeadless() const { return m_headless; }
 
 
         struct Rect
@@ -42,8 +45,10 @@ namespace Runa
         VK2DTexture m_texture = nullptr;
         int m_width = 0;
         int m_height = 0;
+        bool m_headless = false;
 
         void loadFromFile(const std::string &path);
+        void loadSizeFromFile(const std::string &path);
         void createFromPixels(int width, int height, const void *pixelData);
     };
 
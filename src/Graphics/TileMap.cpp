@@ -2,7 +2,9 @@
 
 #include "../runapch.h"
 #include "TileMap.h"
+#include "Camera.h"
 #include "Core/Log.h"
+#include <cmath>
 
 namespace Runa
 {
@@ -19,6 +21,8 @@ namespace Runa
         if (!isValid(x, y))
             return false;
         m_tiles[getIndex(x, y)] = tileIndex;
+        if (m_tileset && tileIndex >= static_cast<int>(m_frames.size()))
+            resolveFrames(tileIndex);
         return true;
     }
 
@@ -32,6 +36,8 @@ namespace Runa
     void TileMap::clear(int fillTile)
     {
         std::fill(m_tiles.begin(), m_tiles.end(), fillTile);
+        if (m_tileset && fillTile >= static_cast<int>(m_frames.size()))
+            resolveFrames(fillTile);
     }
 
     void TileMap::fillRect(int x, int y, int width, int height, int tileIndex)
@@ -45,33 +51,129 @@ namespace Runa
         }
     }
 
+    void TileMap::setTileset(const SpriteSheet &tileset, const std::string &tileBaseName)
+    {
+        m_tileset = &tileset;
+        m_tileBaseName = tileBaseName;
+        m_frames.clear();
+
+        int maxTileIndex = -1;
+        for (int tileIndex : m_tiles)
+            maxTileIndex = std::max(maxTileIndex, tileIndex);
+        resolveFrames(maxTileIndex);
+    }
+
+    // Extends the table to cover tile indices up to maxTileIndex
+    void TileMap::resolveFrames(int maxTileIndex)
+    {
+        const int first = static_cast<int>(m_frames.size());
+        if (maxTileIndex < first)
+            return;
+
+        m_frames.resize(static_cast<size_t>(maxTileIndex) + 1);
+        for (int tileIndex = first; tileIndex <= maxTileIndex; ++tileIndex)
+        {
+            const Sprite *sprite = m_tileset->getSprite(m_tileBaseName + "_" + std::to_string(tileIndex));
+            if (sprite && !sprite->frames.empty())
+                m_frames[tileIndex] = sprite->frames[0];
+        }
+    }
+
+    const SpriteFrame *TileMap::getTileFrame(int tileIndex) const
+    {
+        if (tileIndex < 0 || tileIndex >= static_cast<int>(m_frames.size()))
+            return nullptr;
+        const SpriteFrame &frame = m_frames[tileIndex];
+        return frame.width > 0 ? &frame : nullptr;
+    }
+
     void TileMap::render(SpriteBatch &batch, const SpriteSheet &tileset, const std::string &tileBaseName,
                          int offsetX, int offsetY)
     {
+        if (m_tileset != &tileset || m_tileBaseName != tileBaseName)
+            setTileset(tileset, tileBaseName);
+
+        const Texture &texture = tileset.getTexture();
         for (int y = 0; y < m_height; ++y)
         {
             for (int x = 0; x < m_width; ++x)
             {
-                int tileIndex = getTile(x, y);
-                if (tileIndex < 0)
-                    continue;
-
-
-                std::string spriteName = tileBaseName + "_" + std::to_string(tileIndex);
-                const Sprite *sprite = tileset.getSprite(spriteName);
-
-                if (sprite && !sprite->frames.empty())
+                const SpriteFrame *frame = getTileFrame(m_tiles[getIndex(x, y)]);
+                if (frame)
                 {
-                    const SpriteFrame &frame = sprite->frames[0];
                     int screenX = offsetX + (x * m_tileSize);
                     int screenY = offsetY + (y * m_tileSize);
 
-                    batch.draw(tileset.getTexture(), screenX, screenY, frame);
+                    batch.draw(texture, screenX, screenY, *frame);
                 }
             }
         }
     }
 
+    void TileMap::render(SpriteBatch &batch, const Camera &camera) const
+    {
+        appendVisible(batch, camera, 0.0f);
+    }
+
+    void TileMap::renderLayers(SpriteBatch &batch, const Camera &camera, std::span<const TileMap *const> layers)
+    {
+        for (size_t i = 0; i < layers.size(); ++i)
+        {
+            if (layers[i])
+                layers[i]->appendVisible(batch, camera, static_cast<float>(i));
+        }
+    }
+
+    // Counts the visible tiles, appends that many commands in one go and fills
+    // them in place. Positions are in world units for a batch begun with the camera
+    void TileMap::appendVisible(SpriteBatch &batch, const Camera &camera, float depth) const
+    {
+        if (!m_tileset || m_tileSize <= 0)
+            return;
+
+        const auto bounds = camera.getWorldBounds();
+        const int startX = std::max(0, static_cast<int>(std::floor(bounds.left / m_tileSize)));
+        const int startY = std::max(0, static_cast<int>(std::floor(bounds.top / m_tileSize)));
+        const int endX = std::min(m_width - 1, static_cast<int>(std::floor(bounds.right / m_tileSize)));
+        const int endY = std::min(m_height - 1, static_cast<int>(std::floor(bounds.bottom / m_tileSize)));
+        if (startX > endX || startY > endY)
+            return;
+
+        size_t visible = 0;
+        for (int y = startY; y <= endY; ++y)
+        {
+            const int *row = &m_tiles[getIndex(0, y)];
+            for (int x = startX; x <= endX; ++x)
+            {
+                if (getTileFrame(row[x]))
+                    visible++;
+            }
+        }
+
+        VK2DDrawCommand *command = batch.appendCommands(m_tileset->getTexture(), visible, depth);
+        if (!command)
+            return;
+
+        for (int y = startY; y <= endY; ++y)
+        {
+            const int *row = &m_tiles[getIndex(0, y)];
+            for (int x = startX; x <= endX; ++x)
+            {
+                const SpriteFrame *frame = getTileFrame(row[x]);
+                if (!frame)
+                    continue;
+
+                command->texturePos[0] = static_cast<float>(frame->x);
+                command->texturePos[1] = static_cast<float>(frame->y);
+                command->texturePos[2] = static_cast<float>(frame->width);
+                command->texturePos[3] = static_cast<float>(frame->height);
+                command->pos[0] = static_cast<float>(x * m_tileSize);
+                command->pos[1] = static_cast<float>(y * m_tileSize);
+                command++;
+            }
+        }
+    }
+
     void TileMap::loadFromString(const std::string &data)
     {
         std::istringstream stream(data);
@@ -6,12 +6,15 @@
 #include "RunaAPI.h"
 #include "SpriteBatch.h"
 #include "SpriteSheet.h"
+#include <span>
 #include <vector>
 #include <string>
 #include <unordered_set>
 
 namespace Runa {
 
+class Camera;
+
 class RUNA_API TileMap {
 public:
     TileMap(int width, int height, int tileSize);
@@ -30,9 +33,27 @@ public:
     void fillRect(int x, int y, int width, int height, int tileIndex);
 
 
+    // Resolves "<tileBaseName>_<index>" to a frame once per tile index, so rendering
+    // never builds or hashes sprite names. Call again if the sheet's sprites change
+    void setTileset(const SpriteSheet& tileset, const std::string& tileBaseName);
+
+    // Frame for a tile index, or nullptr if it is empty or the tileset has no such sprite
+    const SpriteFrame* getTileFrame(int tileIndex) const;
+
+
+    // Draws every tile at offset; binds the tileset first if it is not the current one
     void render(SpriteBatch& batch, const SpriteSheet& tileset, const std::string& tileBaseName,
                 int offsetX = 0, int offsetY = 0);
 
+    // Draws only the tiles inside camera.getWorldBounds() with the bound tileset, in
+    // world units: begin the batch with the same camera
+    void render(SpriteBatch& batch, const Camera& camera) const;
+
+    // Draws maps bottom to top, each culled and written straight into the batch's
+    // command array in one append. In a sorted batch map i gets fixed depth i on the
+    // current layer, so stacked tiles keep their order
+    static void renderLayers(SpriteBatch& batch, const Camera& camera, std::span<const TileMap* const> layers);
+
 
     int getWidth() const { return m_width; }
     int getHeight() const { return m_height; }
@@ -52,6 +73,13 @@ private:
     std::vector<int> m_tiles;
     std::unordered_set<int> m_solidTiles;
 
+    const SpriteSheet* m_tileset = nullptr;
+    std::string m_tileBaseName;
+    std::vector<SpriteFrame> m_frames;      // Indexed by tile index; width 0 where the sheet has no sprite
+
+    void resolveFrames(int maxTileIndex);
+    void appendVisible(SpriteBatch& batch, const Camera& camera, float depth) const;
+
     int getIndex(int x, int y) const { return y * m_width + x; }
     bool isValid(int x, int y) const { return x >= 0 && x < m_width && y >= 0 && y < m_height; }
 };
@@ -8,9 +8,14 @@
 namespace Runa
 {
 
-    Window::Window(const std::string &title, int width, int height)
-        : m_width(width), m_height(height)
+    Window::Window(const std::string &title, int width, int height, bool headless)
+        : m_width(width), m_height(height), m_headless(headless)
     {
+        if (m_headless)
+        {
+            LOG_INFO("Headless window: {} ({}x{})", title, width, height);
+            return;
+        }
 
         m_window = SDL_CreateWindow(
             title.c_str(),
@@ -13,7 +13,8 @@ class Input;
 
 class RUNA_API Window {
 public:
-    Window(const std::string& title, int width, int height);
+    // A headless window creates no SDL window; it still polls events and reports its size
+    Window(const std::string& title, int width, int height, bool headless = false);
     ~Window();
 
 
@@ -26,6 +27,7 @@ public:
     int getWidth() const { return m_width; }
     int getHeight() const { return m_height; }
     bool shouldClose() const { return m_shouldClose; }
+    bool isHeadless() const { return m_headless; }
 
     void processEvents();
     void setShouldClose(bool shouldClose) { m_shouldClose = shouldClose; }
@@ -38,6 +40,7 @@ private:
     int m_width;
     int m_height;
     bool m_shouldClose = false;
+    bool m_headless = false;
     Input* m_input = nullptr;
 };
 
@@ -28,7 +28,12 @@ namespace Runa {
 		LOG_INFO("GameScene: Entering");
 
 		m_spriteBatch = std::make_unique<SpriteBatch>(getRenderer());
-		m_grassTexture = std::make_unique<Texture>(getRenderer(), "Resources/SpiteSheets/grass.png");
+		try {
+			m_tileset = std::make_unique<SpriteSheet>(getRenderer(), "Resources/SpiteSheets/grass.png");
+			m_tileset->addSprite("grass_0", 0, 0, TILE_SIZE, TILE_SIZE);
+		} catch (const std::exception& e) {
+			LOG_ERROR("GameScene: Failed to load grass tileset: {}", e.what());
+		}
 		m_camera = std::make_unique<Camera>(getApp().getWindow());
 		m_registry = std::make_unique<ECS::EntityRegistry>();
 
@@ -39,12 +44,15 @@ namespace Runa {
 				m_tileMap->setTile(x, y, 0);
 			}
 		}
+		if (m_tileset) {
+			m_tileMap->setTileset(*m_tileset, "grass");
+		}
 
 
 		m_player = m_registry->createEntity(320.0f, 240.0f);
 		auto& sprite = m_registry->getRegistry().emplace<ECS::Sprite>(m_player);
 		sprite.spriteSheet = nullptr;
-		sprite.spriteName = "";
+		sprite.spriteName = NullStringId;
 		sprite.tintR = 1.0f;
 		sprite.tintG = 0.4f;
 		sprite.tintB = 0.4f;
@@ -90,26 +98,15 @@ namespace Runa {
 	void GameScene::onRender() {
 		getRenderer().clear(0.1f, 0.1f, 0.15f, 1.0f);
 
-		m_spriteBatch->begin();
-
+		// World-space batch: the camera is applied on the GPU
+		m_spriteBatch->begin(SpriteBatch::SortMode::Submission, m_camera.get());
 
-		auto bounds = m_camera->getWorldBounds();
-		int startX = std::max(0, static_cast<int>(bounds.left / TILE_SIZE));
-		int startY = std::max(0, static_cast<int>(bounds.top / TILE_SIZE));
-		int endX = std::min(39, static_cast<int>(bounds.right / TILE_SIZE));
-		int endY = std::min(29, static_cast<int>(bounds.bottom / TILE_SIZE));
 
-		for (int y = startY; y <= endY; ++y) {
-			for (int x = startX; x <= endX; ++x) {
-				int screenX, screenY;
-				m_camera->worldToScreen(x * TILE_SIZE, y * TILE_SIZE, screenX, screenY);
-				m_spriteBatch->draw(*m_grassTexture, screenX, screenY, 0, 0, 
-				                    static_cast<int>(TILE_SIZE), static_cast<int>(TILE_SIZE));
-			}
-		}
+		// Only the tiles inside the camera bounds, appended in one go
+		m_tileMap->render(*m_spriteBatch, *m_camera);
 
 
-		ECS::Systems::renderSprites(m_registry->getRegistry(), *m_spriteBatch, *m_camera);
+		ECS::Systems::renderSprites(m_registry->getRegistry(), *m_spriteBatch);
 
 		m_spriteBatch->end();
 	}
@@ -10,7 +10,7 @@
 
 #include "../Core/Scene.h"
 #include "../Graphics/SpriteBatch.h"
-#include "../Graphics/Texture.h"
+#include "../Graphics/SpriteSheet.h"
 #include "../Graphics/TileMap.h"
 #include "../Graphics/Camera.h"
 #include "../ECS/Registry.h"
@@ -33,7 +33,7 @@ namespace Runa {
 
 	private:
 		std::unique_ptr<SpriteBatch> m_spriteBatch;
-		std::unique_ptr<Texture> m_grassTexture;
+		std::unique_ptr<SpriteSheet> m_tileset;
 		std::unique_ptr<TileMap> m_tileMap;
 		std::unique_ptr<Camera> m_camera;
 		std::unique_ptr<ECS::EntityRegistry> m_registry;
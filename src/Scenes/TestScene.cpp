@@ -15,9 +15,11 @@
 #include "../ECS/Components.h"
 #include "../ECS/RPGComponents.h"
 #include "../ECS/Systems.h"
+#include "../ECS/EventBus.h"
+#include "../ECS/Events.h"
+#include "../ECS/Inspector.h"
 #include "../Collision/CollisionLoader.h"
 #include <cstdlib>
-#include <ctime>
 #include <cmath>
 #include <SDL3/SDL.h>
 #include <filesystem>
@@ -29,18 +31,20 @@ namespace Runa {
 	TestScene::TestScene(Application& app)
 		: Scene(app, "TestScene") {
 		m_type = "TestScene";
+
+		// onRender only reads the snapshot, sprite sheets and fence layout
+		setPipelineSafe(true);
 	}
 
 	void TestScene::onEnter() {
 		LOG_INFO("TestScene: Entering");
 
-		srand(static_cast<unsigned>(time(nullptr)));
-
 		m_spriteBatch = std::make_unique<SpriteBatch>(getRenderer());
 
 		// Initialize camera
 		m_camera = std::make_unique<Camera>(getApp().getWindow());
 		m_camera->setPosition(0.0f, 0.0f);
+		m_renderCamera = std::make_unique<Camera>(getApp().getWindow());
 
 		m_font = std::make_unique<Font>(getRenderer(),
 		                                "Resources/Fonts/Renogare.ttf", 24);
@@ -179,6 +183,22 @@ namespace Runa {
 		// Initialize ECS registry
 		m_registry = std::make_unique<ECS::EntityRegistry>();
 
+		// System events are batched on the bus and delivered once per frame in onUpdate()
+		auto& events = ECS::EventBus::get(m_registry->getRegistry());
+		events.subscribe<ECS::MapCollisionEvent>([this](std::span<const ECS::MapCollisionEvent> batch) {
+			for (const auto& event : batch) {
+				if (event.entity == m_playerEntity) {
+					LOG_DEBUG("Player collision detected!");
+					break;
+				}
+			}
+		});
+		events.subscribe<ECS::TileInteractionEvent>([this](std::span<const ECS::TileInteractionEvent> batch) {
+			for (const auto& event : batch) {
+				handleInteraction(event.entity, *event.interaction);
+			}
+		});
+
 		// Create player entity using ECS
 		// Player sprite is 48x48 pixels (16x16 logical with 3x scale)
 		m_playerEntity = m_registry->createPlayer(0.0f, 0.0f, m_playerSheet.get(), "player_idle_down", 120.0f);
@@ -221,11 +241,19 @@ namespace Runa {
 		m_displayedFPS = 0;
 		m_frameCount = 0;
 
+		m_autosave = std::make_unique<AutosaveService>();
+		m_autosave->setInterval(AUTOSAVE_INTERVAL);
+
 		LOG_INFO("TestScene initialized");
 	}
 
 	void TestScene::onExit() {
 		LOG_INFO("TestScene: Exiting");
+
+		// Finish pending writes before the scene (and its registry) goes away
+		if (m_autosave) {
+			m_autosave->waitIdle();
+		}
 	}
 
 	void TestScene::onPause() {
@@ -257,40 +285,71 @@ namespace Runa {
 		
 		// After loading, restore sprite sheet pointers based on sprite names
 		if (m_registry) {
-			auto& registry = m_registry->getRegistry();
-			auto spriteView = registry.view<ECS::Sprite>();
-			
-			for (auto entity : spriteView) {
-				auto& sprite = spriteView.get<ECS::Sprite>(entity);
-				
-				// Match sprite name to appropriate sprite sheet
-				if (sprite.spriteName.find("player_") != std::string::npos) {
-					sprite.spriteSheet = m_playerSheet.get();
-				} else if (sprite.spriteName.find("fence") != std::string::npos || 
-				           sprite.spriteName.find("wood_fence") != std::string::npos ||
-				           sprite.spriteName.find("vertical_") != std::string::npos ||
-				           sprite.spriteName.find("horizontal_") != std::string::npos) {
-					sprite.spriteSheet = m_fenceSheet.get();
-				} else if (sprite.spriteName.find("decor_grass") != std::string::npos) {
-					sprite.spriteSheet = m_decorGrassSheet.get();
-				} else if (sprite.spriteName == "grass_base") {
-					sprite.spriteSheet = m_baseGrassSheet.get();
-				} else if (sprite.spriteName == "poppy" || sprite.spriteName == "sunflower" ||
-				           sprite.spriteName == "blue_orchid" || sprite.spriteName == "tulip" ||
-				           sprite.spriteName == "allium" || sprite.spriteName == "daisy" ||
-				           sprite.spriteName == "dandelion") {
-					sprite.spriteSheet = m_flowersSheet.get();
-				}
-			}
+			restoreSpriteSheets(m_registry->getRegistry());
+		}
+		
+		return true;
+	}
+
+	void TestScene::restoreSpriteSheets(entt::registry& registry) {
+		auto spriteView = registry.view<ECS::Sprite>();
+		
+		for (auto entity : spriteView) {
+			auto& sprite = spriteView.get<ECS::Sprite>(entity);
 			
-			// Find player entity if it exists
-			auto playerView = registry.view<ECS::Player>();
-			if (!playerView.empty()) {
-				m_playerEntity = *playerView.begin();
-				LOG_INFO("Player entity restored from save");
+			// Match sprite name to appropriate sprite sheet
+			const std::string& spriteName = StringPool::lookup(sprite.spriteName);
+			if (spriteName.find("player_") != std::string::npos) {
+				sprite.spriteSheet = m_playerSheet.get();
+			} else if (spriteName.find("fence") != std::string::npos || 
+			           spriteName.find("wood_fence") != std::string::npos ||
+			           spriteName.find("vertical_") != std::string::npos ||
+			           spriteName.find("horizontal_") != std::string::npos) {
+				sprite.spriteSheet = m_fenceSheet.get();
+			} else if (spriteName.find("decor_grass") != std::string::npos) {
+				sprite.spriteSheet = m_decorGrassSheet.get();
+			} else if (spriteName == "grass_base") {
+				sprite.spriteSheet = m_baseGrassSheet.get();
+			} else if (spriteName == "poppy" || spriteName == "sunflower" ||
+			           spriteName == "blue_orchid" || spriteName == "tulip" ||
+			           spriteName == "allium" || spriteName == "daisy" ||
+			           spriteName == "dandelion") {
+				sprite.spriteSheet = m_flowersSheet.get();
 			}
 		}
 		
+		// Find player entity if it exists
+		auto playerView = registry.view<ECS::Player>();
+		if (!playerView.empty()) {
+			m_playerEntity = *playerView.begin();
+			LOG_INFO("Player entity restored from save");
+		}
+	}
+	
+	bool TestScene::quickSave(const std::string& filePath) {
+		if (!m_registry || !m_autosave) {
+			return false;
+		}
+		
+		return m_autosave->requestSave(m_registry->getRegistry(), m_collisionMap.get(), filePath);
+	}
+	
+	bool TestScene::quickLoad(const std::string& filePath) {
+		if (!m_registry || !std::filesystem::exists(filePath)) {
+			return false;
+		}
+		
+		// Don't read a file the worker may still be renaming into place
+		if (m_autosave) {
+			m_autosave->waitIdle();
+		}
+		
+		auto& registry = m_registry->getRegistry();
+		if (!AutosaveService::load(filePath, registry, m_collisionMap.get())) {
+			return false;
+		}
+		
+		restoreSpriteSheets(registry);
 		return true;
 	}
 
@@ -299,6 +358,9 @@ namespace Runa {
 		if (m_registry) {
 			auto& registry = m_registry->getRegistry();
 
+			// Remember where everything was at the start of this tick for render interpolation
+			ECS::Systems::storePreviousPositions(registry);
+
 			// Update player input (handles keyboard input and sets velocity)
 			// Pass keybindings so it uses the metadata file
 			ECS::Systems::updatePlayerInput(registry, getInput(), deltaTime, m_keybindings.get());
@@ -311,47 +373,76 @@ namespace Runa {
 			
 			// Then check for collisions and clamp position back if needed
 			if (m_collisionMap) {
-				ECS::Systems::updateMapCollision(registry, *m_collisionMap, deltaTime,
-					[this](entt::entity entity, const ECS::CollisionEvent& event) {
-						// Collision detected - log for debugging
-						if (entity == m_playerEntity) {
-							LOG_DEBUG("Player collision detected!");
-						}
-					});
+				ECS::Systems::updateMapCollision(registry, *m_collisionMap, deltaTime);
 			}
 
 			// Update animations (advances frame based on time)
 			ECS::Systems::updateAnimation(registry, deltaTime);
 
-			// Update camera to follow player
-			ECS::Systems::updateCameraFollow(registry, *m_camera, deltaTime);
-			
 			// Check for tile interactions (E key)
 			if (m_collisionMap) {
-				ECS::Systems::updateTileInteraction(registry, *m_collisionMap, getInput(), SDLK_E,
-					[this](entt::entity player, TileInteraction& interaction) {
-						handleInteraction(player, interaction);
-					});
+				ECS::Systems::updateTileInteraction(registry, *m_collisionMap, getInput(), SDLK_E);
+			}
+
+			// Sync point: hand this frame's collision and interaction events to subscribers
+			ECS::EventBus::get(registry).dispatch();
+
+			// Periodic autosave (capture only; the write happens in the background)
+			if (m_autosave) {
+				m_autosave->update(deltaTime, registry, m_collisionMap.get(), "Resources/saves/autosave.rsav");
 			}
 		}
 
 		// Update camera
 		m_camera->update(deltaTime);
 		
-		// Save scene on F5 (for testing)
+		// Quicksave on F5 (for testing)
 		if (getInput().isKeyPressed(SDLK_F5)) {
-			if (saveScene()) {
-				LOG_INFO("Scene saved to Resources/saves/scene_save.yaml");
+			if (quickSave()) {
+				LOG_INFO("Quicksave queued to Resources/saves/quicksave.rsav");
 			}
 		}
 		
-		// Load scene on F6 (for testing)
+		// Toggle the component inspector overlay on F3
+		if (getInput().isKeyPressed(SDLK_F3)) {
+			m_showInspector = !m_showInspector;
+		}
+
+		// Load scene on F6 (for testing), falling back to the YAML save
 		if (getInput().isKeyPressed(SDLK_F6)) {
-			if (loadScene()) {
+			if (quickLoad()) {
+				LOG_INFO("Scene loaded from Resources/saves/quicksave.rsav");
+			} else if (loadScene()) {
 				LOG_INFO("Scene loaded from Resources/saves/scene_save.yaml");
 			}
 		}
 
+	}
+
+	void TestScene::onExtract(RenderSnapshot& snapshot) {
+		if (m_registry) {
+			auto& registry = m_registry->getRegistry();
+
+			// Follow the player at its interpolated position so it doesn't jitter against the world
+			ECS::Systems::updateCameraFollow(registry, *m_camera, 0.0f, snapshot.interpolationAlpha);
+			ECS::Systems::extractSprites(registry, snapshot, snapshot.interpolationAlpha);
+
+			// Formatted here because onRender must not read the registry
+			if (m_showInspector) {
+				ECS::Inspector::describeEntity(registry, m_playerEntity, snapshot.debugLines);
+				ECS::Inspector::describeStorages(registry, snapshot.debugLines);
+			}
+		}
+
+		snapshot.cameraX = m_camera->getX();
+		snapshot.cameraY = m_camera->getY();
+		snapshot.cameraZoom = m_camera->getZoom();
+	}
+
+	void TestScene::onRender() {
+		getRenderer().clear(0.2f, 0.4f, 0.6f, 1.0f);
+
+		// Counted here, not in onUpdate, which runs at the fixed tick rate
 		m_frameCount++;
 
 		auto now = std::chrono::steady_clock::now();
@@ -363,117 +454,34 @@ namespace Runa {
 			m_frameCount = 0;
 			m_lastFPSUpdate = now;
 		}
-	}
 
-	void TestScene::onRender() {
-		getRenderer().clear(0.2f, 0.4f, 0.6f, 1.0f);
+		// Everything below reads the snapshot, never the registry or m_camera, which the
+		// simulation may already be advancing
+		const RenderSnapshot& snapshot = getRenderSnapshot();
+		m_renderCamera->setPosition(snapshot.cameraX, snapshot.cameraY);
+		m_renderCamera->setZoom(snapshot.cameraZoom);
 
-		m_spriteBatch->begin();
+		// Meadow: one draw per visible chunk from persistent GPU buffers, under everything else
+		if (m_meadowLayer) {
+			m_meadowLayer->draw(*m_renderCamera);
+		}
 
-		// Get camera bounds for culling
-		auto cameraBounds = m_camera->getWorldBounds();
-		const int tileSize = 16;
-		const int scaledTileSize = PixelScale::getScaledTileSize(tileSize);
-
-		// Render meadow first (so it appears underneath fences)
-		// Calculate which tiles are visible (with padding for edge tiles that might be partially visible)
-		// Use floor/ceiling to ensure we cover all visible tiles
-		// Note: cameraBounds are in world/logical space, so padding should use tileSize (16), not scaledTileSize (48)
-		int startTileX = static_cast<int>(std::floor((cameraBounds.left - tileSize) / tileSize));
-		int startTileY = static_cast<int>(std::floor((cameraBounds.top - tileSize) / tileSize));
-		int endTileX = static_cast<int>(std::ceil((cameraBounds.right + tileSize) / tileSize));
-		int endTileY = static_cast<int>(std::ceil((cameraBounds.bottom + tileSize) / tileSize));
-
-		// Render only visible meadow tiles
-		if (m_baseGrassSheet) {
-			const auto* baseSprite = m_baseGrassSheet->getSprite("grass_base");
-			if (baseSprite && !baseSprite->frames.empty()) {
-				const auto& baseFrame = baseSprite->frames[0];
-
-				// Meadow extends to a very large area (effectively infinite for gameplay)
-				// This ensures meadow is always visible beyond screen edges
-				const int worldMeadowSize = 2000;  // 2000x2000 tiles = 32000x32000 pixels
-				const int worldMeadowStartX = -(worldMeadowSize * tileSize) >> 1;
-				const int worldMeadowStartY = -(worldMeadowSize * tileSize) >> 1;
-				const int worldMeadowEndX = worldMeadowStartX + worldMeadowSize * tileSize;
-				const int worldMeadowEndY = worldMeadowStartY + worldMeadowSize * tileSize;
-
-				// Clamp to meadow bounds (but meadow is large enough to cover most camera positions)
-				int clampedStartX = std::max(startTileX, worldMeadowStartX / tileSize);
-				int clampedStartY = std::max(startTileY, worldMeadowStartY / tileSize);
-				int clampedEndX = std::min(endTileX, worldMeadowEndX / tileSize);
-				int clampedEndY = std::min(endTileY, worldMeadowEndY / tileSize);
-
-				// Render visible tiles (only calculate and render what's actually seen)
-				for (int tileY = clampedStartY; tileY < clampedEndY; ++tileY) {
-					for (int tileX = clampedStartX; tileX < clampedEndX; ++tileX) {
-						// Calculate world position of tile center
-						int worldX = tileX * tileSize;
-						int worldY = tileY * tileSize;
-
-						// Convert world coordinates to screen coordinates
-						int screenX, screenY;
-						m_camera->worldToScreen(static_cast<float>(worldX), static_cast<float>(worldY), screenX, screenY);
-
-						// Only render if tile is actually on screen (with some margin for partially visible tiles)
-						// This is an additional check to avoid rendering completely off-screen tiles
-						if (screenX + scaledTileSize >= 0 && screenX - scaledTileSize < getApp().getWindow().getWidth() &&
-							screenY + scaledTileSize >= 0 && screenY - scaledTileSize < getApp().getWindow().getHeight()) {
-							// Render base grass
-							m_spriteBatch->draw(m_baseGrassSheet->getTexture(),
-							                   screenX, screenY,
-							                   baseFrame.x, baseFrame.y,
-							                   baseFrame.width, baseFrame.height);
-
-							// Add decorative elements (flowers and grass blades) using deterministic randomness
-							// Use tile coordinates as seed for consistent placement
-							unsigned int seed = static_cast<unsigned int>(tileX * 73856093u + tileY * 19349663u);
-							seed = seed ^ (seed >> 16);
-							seed = seed * 2246822507u;
-							seed = seed ^ (seed >> 13);
-							seed = seed * 3266489917u;
-							seed = seed ^ (seed >> 16);
-
-							float randValue = static_cast<float>(seed & 0x7FFFFFFF) / 2147483647.0f;
-
-							// 12% chance for a flower
-							if (randValue < 0.12f && m_flowersSheet) {
-								// Choose random flower type (7 different flowers)
-								int flowerIndex = static_cast<int>((randValue * 10000.0f)) % 7;
-								std::string flowerNames[] = {"poppy", "sunflower", "blue_orchid", "tulip",
-								                             "allium", "daisy", "dandelion"};
-								std::string flowerName = flowerNames[flowerIndex];
-
-								const auto* flowerSprite = m_flowersSheet->getSprite(flowerName);
-								if (flowerSprite && !flowerSprite->frames.empty()) {
-									const auto& flowerFrame = flowerSprite->frames[0];
-									m_spriteBatch->draw(m_flowersSheet->getTexture(),
-									                   screenX, screenY,
-									                   flowerFrame.x, flowerFrame.y,
-									                   flowerFrame.width, flowerFrame.height);
-								}
-							}
-							// 35% chance for decorative grass (fills gaps, appears more often than flowers)
-							else if (randValue < 0.47f && m_decorGrassSheet) {
-								// Choose random grass blade
-								int grassIndex = static_cast<int>((randValue * 10000.0f)) % 16;
-								std::string grassName = "decor_grass_" + std::to_string(grassIndex);
-
-								const auto* grassSprite = m_decorGrassSheet->getSprite(grassName);
-								if (grassSprite && !grassSprite->frames.empty()) {
-									const auto& grassFrame = grassSprite->frames[0];
-									m_spriteBatch->draw(m_decorGrassSheet->getTexture(),
-									                   screenX, screenY,
-									                   grassFrame.x, grassFrame.y,
-									                   grassFrame.width, grassFrame.height);
-								}
-							}
-						}
-					}
-				}
-			}
+		// Sorted world-space batch: fences and entities Y-sorted together, moved
+		// and zoomed by the camera on the GPU
+		m_spriteBatch->begin(SpriteBatch::SortMode::Sorted, m_renderCamera.get());
+
+		// Decorations lie flat on the meadow, under anything Y-sorted
+		if (m_decorLayer) {
+			m_spriteBatch->setLayer(SpriteBatch::LAYER_GROUND, 0.0f);
+			m_decorLayer->render(*m_spriteBatch, *m_renderCamera);
 		}
 
+		// Get camera bounds for culling
+		auto cameraBounds = m_renderCamera->getWorldBounds();
+
+		// Fences and entities share the world layer, ordered by their bottom edge
+		m_spriteBatch->setLayer(SpriteBatch::LAYER_WORLD);
+
 		// Render fence (only visible fences)
 		if (m_fenceSheet) {
 			for (const auto& tile : m_fenceTiles) {
@@ -498,47 +506,138 @@ namespace Runa {
 						continue; // Skip invisible fence
 					}
 
-					// Convert world coordinates to screen coordinates
-					int screenX, screenY;
-					m_camera->worldToScreen(fenceWorldX, fenceWorldY, screenX, screenY);
-
 					m_spriteBatch->draw(m_fenceSheet->getTexture(),
-					                   screenX, screenY,
+					                   fenceWorldX, fenceWorldY,
 					                   frame.x, frame.y,
 					                   frame.width, frame.height);
 				}
 			}
 		}
 
-		// Render all ECS entities (including player) using the ECS render system
-		if (m_registry) {
-			// Create a white pixel texture for entities without sprites (if needed)
-			// For now, we'll just render entities with sprites
-			ECS::Systems::renderSprites(m_registry->getRegistry(), *m_spriteBatch, *m_camera, nullptr);
-		}
+		// Render all ECS entities (including player) from the extracted sprite list
+		ECS::Systems::drawSprites(snapshot, *m_spriteBatch, nullptr);
 
-		// Render FPS counter in white (on top of meadow)
+		m_spriteBatch->end();
+
+		// Render FPS counter and inspector lines in white (on top of meadow), in screen pixels
 		if (m_font && m_font->isValid()) {
-			std::string fpsText = "FPS: " + std::to_string(m_displayedFPS);
 			SDL_Color white = {255, 255, 255, 255};
-			auto fpsTexture = m_font->renderText(fpsText, white);
+			std::vector<std::unique_ptr<Texture>> lineTextures;
+			lineTextures.push_back(m_font->renderText("FPS: " + std::to_string(m_displayedFPS), white));
+			for (const auto& line : snapshot.debugLines) {
+				lineTextures.push_back(m_font->renderText(line, white));
+			}
 
-			if (fpsTexture) {
-				// Use 1/3 scale to compensate for global 3x pixel scale
-				m_spriteBatch->draw(*fpsTexture, 10, 10, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f / 3.0f, 1.0f / 3.0f);
+			// Use 1/3 scale to compensate for global 3x pixel scale
+			const float textScale = 1.0f / 3.0f;
+			float y = 10.0f;
+			m_spriteBatch->begin();
+			for (const auto& texture : lineTextures) {
+				if (texture) {
+					m_spriteBatch->draw(*texture, 10, y, 1.0f, 1.0f, 1.0f, 1.0f, textScale, textScale);
+				}
+				y += m_font->getFontSize() * textScale;
 			}
+			m_spriteBatch->end();
 		}
+	}
 
-		m_spriteBatch->end();
+	void TestScene::generateMeadowChunk(StaticTileLayer& layer, int firstTileX, int firstTileY) {
+		if (!m_baseGrassSheet) {
+			return;
+		}
+		const auto* baseSprite = m_baseGrassSheet->getSprite("grass_base");
+		if (!baseSprite || baseSprite->frames.empty()) {
+			return;
+		}
+		const auto& baseFrame = baseSprite->frames[0];
+
+		// Meadow extends to a very large area (effectively infinite for gameplay)
+		const int worldMeadowSize = 2000;  // 2000x2000 tiles = 32000x32000 pixels
+		const int meadowStartTile = -(worldMeadowSize >> 1);
+		const int meadowEndTile = meadowStartTile + worldMeadowSize;
+
+		const int lastTileX = std::min(firstTileX + StaticTileLayer::CHUNK_TILES, meadowEndTile);
+		const int lastTileY = std::min(firstTileY + StaticTileLayer::CHUNK_TILES, meadowEndTile);
+		for (int tileY = std::max(firstTileY, meadowStartTile); tileY < lastTileY; ++tileY) {
+			for (int tileX = std::max(firstTileX, meadowStartTile); tileX < lastTileX; ++tileX) {
+				layer.addSprite(tileX, tileY, m_baseGrassSheet->getTexture(), baseFrame);
+			}
+		}
+	}
+
+	// Flowers and grass blades, generated on worker threads (see ProceduralLayer)
+	void TestScene::generateMeadowDecorations(int tileSize) {
+		m_decorLayer = std::make_unique<ProceduralLayer>(tileSize, 0u);
+
+		// Decoration indices: flowers first, then grass blades
+		static const char* flowerNames[] = {"poppy", "sunflower", "blue_orchid", "tulip",
+		                                    "allium", "daisy", "dandelion"};
+		std::vector<int> flowers;
+		std::vector<int> grasses;
+
+		if (m_flowersSheet) {
+			for (const char* name : flowerNames) {
+				const auto* sprite = m_flowersSheet->getSprite(name);
+				flowers.push_back(sprite && !sprite->frames.empty()
+					? m_decorLayer->addDecoration(m_flowersSheet->getTexture(), sprite->frames[0]) : -1);
+			}
+		}
+		if (m_decorGrassSheet) {
+			for (int i = 0; i < 16; ++i) {
+				const auto* sprite = m_decorGrassSheet->getSprite("decor_grass_" + std::to_string(i));
+				grasses.push_back(sprite && !sprite->frames.empty()
+					? m_decorLayer->addDecoration(m_decorGrassSheet->getTexture(), sprite->frames[0]) : -1);
+			}
+		}
+
+		// Captures only copies: the generator runs on workers
+		m_decorLayer->setGenerator([flowers, grasses](int firstTileX, int firstTileY, uint32_t seed,
+		                                              std::vector<ProceduralLayer::Instance>& out) {
+			const int worldMeadowSize = 2000;
+			const int meadowStartTile = -(worldMeadowSize >> 1);
+			const int meadowEndTile = meadowStartTile + worldMeadowSize;
+
+			const int lastTileX = std::min(firstTileX + ProceduralLayer::CHUNK_TILES, meadowEndTile);
+			const int lastTileY = std::min(firstTileY + ProceduralLayer::CHUNK_TILES, meadowEndTile);
+			for (int tileY = std::max(firstTileY, meadowStartTile); tileY < lastTileY; ++tileY) {
+				for (int tileX = std::max(firstTileX, meadowStartTile); tileX < lastTileX; ++tileX) {
+					// Tile coordinates as seed for consistent placement
+					uint32_t hash = ProceduralLayer::hashTile(seed, tileX, tileY);
+					float randValue = static_cast<float>(hash & 0x7FFFFFFF) / 2147483647.0f;
+
+					int decoration = -1;
+					// 12% chance for a flower, 35% for a grass blade
+					if (randValue < 0.12f && !flowers.empty()) {
+						decoration = flowers[static_cast<int>((randValue * 10000.0f)) % flowers.size()];
+					} else if (randValue >= 0.12f && randValue < 0.47f && !grasses.empty()) {
+						decoration = grasses[static_cast<int>((randValue * 10000.0f)) % grasses.size()];
+					}
+
+					if (decoration >= 0) {
+						const int localX = tileX - firstTileX;
+						const int localY = tileY - firstTileY;
+						out.push_back({static_cast<uint16_t>(localY * ProceduralLayer::CHUNK_TILES + localX),
+						               static_cast<uint16_t>(decoration)});
+					}
+				}
+			}
+		});
 	}
 
 	void TestScene::generateMeadow() {
 		const int tileSize = 16;
 		const int scaledTileSize = PixelScale::getScaledTileSize(tileSize);  // 48 pixels
 
+		// Meadow tiles are generated a chunk at a time the first time the camera sees them,
+		// then stay on the GPU (see generateMeadowChunk)
+		m_meadowLayer = std::make_unique<StaticTileLayer>(getRenderer(), tileSize);
+		m_meadowLayer->setGenerator([this](StaticTileLayer& layer, int firstTileX, int firstTileY) {
+			generateMeadowChunk(layer, firstTileX, firstTileY);
+		});
+		generateMeadowDecorations(tileSize);
+
 		// Inner fenced meadow area (smaller, centered)
-		// Note: Meadow tiles are generated on-the-fly during rendering based on camera bounds
-		// No need to pre-generate all tiles - this saves memory and ensures only visible tiles are calculated
 		const int fencedMeadowSize = 80;  // 80x80 tiles
 		const int fencedMeadowStartX = -(fencedMeadowSize * tileSize) >> 1;
 		const int fencedMeadowStartY = -(fencedMeadowSize * tileSize) >> 1;
@@ -652,7 +751,15 @@ namespace Runa {
 		float speed = std::sqrt(velocity->x * velocity->x + velocity->y * velocity->y);
 		bool isMoving = speed > 0.1f;  // Threshold to avoid jitter
 
-		std::string newSpriteName;
+		// Interned once; the per-frame comparisons below are integer compares
+		static const StringId walkDownId = StringPool::intern("player_walk_down");
+		static const StringId walkUpId = StringPool::intern("player_walk_up");
+		static const StringId walkRightId = StringPool::intern("player_walk_right");
+		static const StringId idleDownId = StringPool::intern("player_idle_down");
+		static const StringId idleUpId = StringPool::intern("player_idle_up");
+		static const StringId idleRightId = StringPool::intern("player_idle_right");
+
+		StringId newSpriteName = NullStringId;
 		bool newFlipX = sprite->flipX;
 
 		if (isMoving) {
@@ -660,35 +767,33 @@ namespace Runa {
 			if (std::abs(velocity->y) > std::abs(velocity->x)) {
 				// Vertical movement
 				if (velocity->y > 0) {
-					newSpriteName = "player_walk_down";
+					newSpriteName = walkDownId;
 					newFlipX = false;  // No flip for down
 				} else {
-					newSpriteName = "player_walk_up";
+					newSpriteName = walkUpId;
 					newFlipX = false;  // No flip for up
 				}
 			} else {
 				// Horizontal movement - use right-facing sprite for both directions
 				// Flip horizontally when moving left
-				newSpriteName = "player_walk_right";
+				newSpriteName = walkRightId;
 				newFlipX = (velocity->x < 0);  // Flip when moving left
 			}
 		} else {
 			// Not moving - use idle animation based on last direction
 			// If we don't have a last direction, default to down
-			if (sprite->spriteName.find("walk_down") != std::string::npos || 
-			    sprite->spriteName.find("idle_down") != std::string::npos) {
-				newSpriteName = "player_idle_down";
+			if (sprite->spriteName == walkDownId || sprite->spriteName == idleDownId) {
+				newSpriteName = idleDownId;
 				newFlipX = false;  // No flip for down
-			} else if (sprite->spriteName.find("walk_up") != std::string::npos ||
-			           sprite->spriteName.find("idle_up") != std::string::npos) {
-				newSpriteName = "player_idle_up";
+			} else if (sprite->spriteName == walkUpId || sprite->spriteName == idleUpId) {
+				newSpriteName = idleUpId;
 				newFlipX = false;  // No flip for up
 			} else {
 				// For horizontal directions, use right-facing idle and maintain flip state
-				newSpriteName = "player_idle_right";
+				newSpriteName = idleRightId;
 				// Maintain the flip state from the last movement direction
 				// If the sprite name contains "left" or flipX was true, keep it flipped
-				if (sprite->spriteName.find("left") != std::string::npos || sprite->flipX) {
+				if (StringPool::lookup(sprite->spriteName).find("left") != std::string::npos || sprite->flipX) {
 					newFlipX = true;   // Keep flipped if was facing left
 				} else {
 					newFlipX = false;  // No flip if was facing right
@@ -719,9 +824,9 @@ namespace Runa {
 		if (directionChanged && position) {
 			// Determine actual facing direction for clearer logging
 			std::string actualDirection;
-			if (newSpriteName.find("down") != std::string::npos) {
+			if (newSpriteName == walkDownId || newSpriteName == idleDownId) {
 				actualDirection = "down";
-			} else if (newSpriteName.find("up") != std::string::npos) {
+			} else if (newSpriteName == walkUpId || newSpriteName == idleUpId) {
 				actualDirection = "up";
 			} else if (newFlipX) {
 				actualDirection = "left";  // Right sprite flipped = facing left
@@ -729,7 +834,7 @@ namespace Runa {
 				actualDirection = "right";
 			}
 		LOG_INFO("Player facing '{}' (sprite: '{}', flipX: {}) at position ({}, {})", 
-		         actualDirection, newSpriteName, newFlipX, position->x, position->y);
+		         actualDirection, StringPool::lookup(newSpriteName), newFlipX, position->x, position->y);
 	}
 }
 
@@ -758,20 +863,28 @@ void TestScene::setupCollisionMap() {
 		uniqueSprites.insert(fenceTile.spriteName);
 	}
 	
+	std::vector<std::string> maskSprites;
+	std::vector<MaskRegion> maskRegions;
 	for (const std::string& spriteName : uniqueSprites) {
 		const auto* sprite = m_fenceSheet->getSprite(spriteName);
 		if (sprite && !sprite->frames.empty()) {
 			const auto& frame = sprite->frames[0];
-			// Create pixel-perfect mask from sprite alpha channel
-			auto mask = CollisionLoader::createMaskFromSprite(
-				m_fenceSheet.get(), frame.x, frame.y, frame.width, frame.height, 128);
-			fenceMasks[spriteName] = mask;
-			if (mask && mask->isValid()) {
-				LOG_INFO("Created pixel-perfect mask for fence sprite '{}' ({}x{})", 
-				         spriteName, mask->getWidth(), mask->getHeight());
-			} else {
-				LOG_WARN("Failed to create pixel-perfect mask for fence sprite '{}'", spriteName);
-			}
+			maskSprites.push_back(spriteName);
+			maskRegions.push_back({frame.x, frame.y, frame.width, frame.height});
+		}
+	}
+	
+	// Create pixel-perfect masks from the sprites' alpha channel (decoded once, baked in parallel)
+	auto masks = CollisionLoader::createMasksFromSprite(m_fenceSheet.get(), maskRegions, 128);
+	for (size_t i = 0; i < masks.size(); ++i) {
+		const std::string& spriteName = maskSprites[i];
+		const auto& mask = masks[i];
+		fenceMasks[spriteName] = mask;
+		if (mask && mask->isValid()) {
+			LOG_INFO("Created pixel-perfect mask for fence sprite '{}' ({}x{})", 
+			         spriteName, mask->getWidth(), mask->getHeight());
+		} else {
+			LOG_WARN("Failed to create pixel-perfect mask for fence sprite '{}'", spriteName);
 		}
 	}
 	
@@ -12,10 +12,13 @@
 #include "../Core/Keybindings.h"
 #include "../Graphics/SpriteBatch.h"
 #include "../Graphics/SpriteSheet.h"
+#include "../Graphics/StaticTileLayer.h"
+#include "../Graphics/ProceduralLayer.h"
 #include "../Graphics/Camera.h"
 #include "../Graphics/Font.h"
 #include "../ECS/Registry.h"
 #include "../Collision/CollisionMap.h"
+#include "../Core/AutosaveService.h"
 #include <memory>
 #include <entt/entt.hpp>
 #include <vector>
@@ -34,6 +37,7 @@ namespace Runa {
 		void onPause() override;
 		void onResume() override;
 		void onUpdate(float dt) override;
+		void onExtract(RenderSnapshot& snapshot) override;
 		void onRender() override;
 		
 		// Serialization support
@@ -43,14 +47,24 @@ namespace Runa {
 		bool saveScene(const std::string& filePath = "Resources/saves/scene_save.yaml");
 		bool loadScene(const std::string& filePath = "Resources/saves/scene_save.yaml");
 
+		// Binary quicksave/autosave, written in the background
+		bool quickSave(const std::string& filePath = "Resources/saves/quicksave.rsav");
+		bool quickLoad(const std::string& filePath = "Resources/saves/quicksave.rsav");
+
 	private:
 		void generateMeadow();
+		void generateMeadowChunk(StaticTileLayer& layer, int firstTileX, int firstTileY);
+		void generateMeadowDecorations(int tileSize);
 		void updatePlayerAnimation(entt::registry& registry);
 		void setupCollisionMap();
 		void handleInteraction(entt::entity player, TileInteraction& interaction);
+		void restoreSpriteSheets(entt::registry& registry);
 
 		std::unique_ptr<SpriteBatch> m_spriteBatch;
+		std::unique_ptr<StaticTileLayer> m_meadowLayer;  // Baked meadow chunks
+		std::unique_ptr<ProceduralLayer> m_decorLayer;   // Flowers and grass blades over the meadow
 		std::unique_ptr<Camera> m_camera;
+		std::unique_ptr<Camera> m_renderCamera;  // Rebuilt from the render snapshot each frame
 		std::unique_ptr<Font> m_font;
 		std::unique_ptr<Keybindings> m_keybindings;
 		
@@ -68,6 +82,10 @@ namespace Runa {
 		// Collision system
 		std::unique_ptr<CollisionMap> m_collisionMap;
 
+		// Background saves
+		std::unique_ptr<AutosaveService> m_autosave;
+		static constexpr float AUTOSAVE_INTERVAL = 60.0f;  // seconds
+
 		// Fence tiles (pre-generated)
 		struct FenceTile {
 			int x, y;
@@ -79,6 +97,9 @@ namespace Runa {
 		std::chrono::steady_clock::time_point m_lastFPSUpdate;
 		int m_displayedFPS = 0;
 		int m_frameCount = 0;
+
+		// Component inspector under the FPS counter (F3)
+		bool m_showInspector = false;
 		
 		// Meadow bounds
 		static constexpr int MEADOW_SIZE = 40;  // tiles
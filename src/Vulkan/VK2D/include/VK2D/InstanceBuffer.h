@@ -0,0 +1,52 @@
+// File: src/Vulkan/VK2D/include/VK2D/InstanceBuffer.h
+// / \file InstanceBuffer.h
+// / \brief Persistent, device-local sprite instances for static geometry
+
+#pragma once
+#include "VK2D/Structs.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \brief Creates an empty instance buffer
+/// \param capacity Number of draw commands to reserve vram for (grows on
+/// demand)
+/// \return A new instance buffer or NULL if it failed
+///
+/// An instance buffer keeps processed sprite instances in vram between frames,
+/// so static geometry (tile layers and the like) costs one draw call a frame
+/// instead of one draw command per sprite. Commands are only processed again
+/// after vk2dInstanceBufferUpdate.
+VK2DInstanceBuffer vk2dInstanceBufferCreate(uint32_t capacity);
+
+/// \brief Frees an instance buffer
+/// \param instanceBuffer Instance buffer to free
+/// \warning This waits for the GPU to finish with the buffer, prefer reusing
+/// buffers through vk2dInstanceBufferUpdate over freeing them mid-game.
+void vk2dInstanceBufferFree(VK2DInstanceBuffer instanceBuffer);
+
+/// \brief Replaces the contents of an instance buffer
+/// \param instanceBuffer Instance buffer to update
+/// \param commands Draw commands, positions are relative to the buffer's origin
+/// \param count Number of draw commands
+///
+/// The commands are copied; they are uploaded and processed on the GPU the next
+/// time the buffer is drawn. Updating past the current capacity waits for the
+/// GPU before reallocating, same as vk2dShadowEnvironmentFlushVBO.
+void vk2dInstanceBufferUpdate(VK2DInstanceBuffer instanceBuffer,
+                              const VK2DDrawCommand *commands, uint32_t count);
+
+/// \brief Returns the number of draw commands in an instance buffer
+/// \param instanceBuffer Instance buffer to query
+/// \return Number of instances drawn by vk2dRendererDrawInstanceBuffer
+uint32_t vk2dInstanceBufferGetCount(VK2DInstanceBuffer instanceBuffer);
+
+/// \brief Returns how many draw commands fit without reallocating
+/// \param instanceBuffer Instance buffer to query
+/// \return Capacity of the vram buffer; updates up to this count never wait
+uint32_t vk2dInstanceBufferGetCapacity(VK2DInstanceBuffer instanceBuffer);
+
+#ifdef __cplusplus
+}
+#endif
@@ -215,6 +215,16 @@ struct VK2DShadowEnvironment_t {
   int verticesCount; ///< Number of vertices in the vertices list
 };
 
+/// \brief Sprite instances kept in vram between frames
+struct VK2DInstanceBuffer_t {
+  VK2DBuffer instances;      ///< Processed VK2DDrawInstances (device local)
+  VK2DDrawCommand *commands; ///< Draw commands waiting to be processed
+  uint32_t count;            ///< Number of draw commands/instances
+  uint32_t capacity;         ///< Number of instances the vram buffer holds
+  uint32_t commandsSize;     ///< Size of the command list in elements
+  bool dirty; ///< Commands changed since the instances were last processed
+};
+
 /// \brief Information per texture
 typedef struct VK2DTextureDescriptorInfo_t {
   bool active;
@@ -277,6 +287,8 @@ struct VK2DRenderer_t {
       uboDescriptorSets[VK2D_MAX_FRAMES_IN_FLIGHT]; ///< Descriptor sets holding
                                                     ///< a UBO per frame in
                                                     ///< flight
+  VkDescriptorSet frameUBOSet; ///< Set draws bind for workingUBO, replaced by a
+                               ///< fresh one when cameras change mid-frame
   VK2DUniformBufferObject workingUBO; ///< This frame's ubo, basically just has
                                       ///< VK2D_MAX_CAMERAS viewproj matricies
 
@@ -315,6 +327,7 @@ struct VK2DRenderer_t {
   VK2DPipeline instancedPipe;   ///< Pipeline for instancing textures
   VK2DPipeline shadowsPipe;     ///< Pipeline for hardware-accelerated shadows
   VK2DPipeline spriteBatchPipe; ///< Compute pipeline for sprite batching
+  VK2DPipeline spriteCullPipe;  ///< Compute pipeline for culling sprite batches
   uint32_t shaderListSize;      ///< Size of the list of customShaders
   VK2DShader *customShaders;    ///< Custom shaders the user creates
 
@@ -330,6 +343,7 @@ struct VK2DRenderer_t {
       dslTextureArray; ///< Descriptor set layout for texture array
   VkDescriptorSetLayout
       dslSpriteBatch;                 ///< DSL for compute sprite batch pipeline
+  VkDescriptorSetLayout dslSpriteCull; ///< DSL for compute sprite cull pipeline
   VkDescriptorSetLayout dslBufferSBO; ///< Vertex shader for instanced pipe SBO
   VK2DDescCon descConSamplers;        ///< Descriptor controller for samplers
   VK2DDescCon
@@ -340,12 +354,19 @@ struct VK2DRenderer_t {
       descConCompute[VK2D_MAX_FRAMES_IN_FLIGHT]; ///< Descriptor controller for
                                                  ///< sprite batch compute
                                                  ///< buffer
+  VK2DDescCon
+      descConCull[VK2D_MAX_FRAMES_IN_FLIGHT]; ///< Descriptor controller for
+                                              ///< sprite batch culling
   VK2DDescCon
       descConShaders[VK2D_MAX_FRAMES_IN_FLIGHT]; ///< Descriptor controller for
                                                  ///< user shaders
   VK2DDescCon
       descConSBO[VK2D_MAX_FRAMES_IN_FLIGHT]; ///< Descriptor controller for
                                              ///< sprite batch vertex shader SBO
+  VK2DDescCon
+      descConVPFrame[VK2D_MAX_FRAMES_IN_FLIGHT]; ///< Descriptor controller for
+                                                 ///< per-draw view projection
+                                                 ///< buffers
   VkDescriptorPool samplerPool;              ///< Sampler pool for 1 sampler
   VkDescriptorPool texArrayPool;             ///< Tex array pool
   VkDescriptorSet texArrayDescriptorSet;     ///< Tex array set
@@ -261,6 +261,11 @@ double vk2dRendererGetAverageFrameTime();
 /// function does not allow the `w/hOnScreen` to change (the default camera's
 /// `w/hOnScreen` should almost always be the window size - if you need
 /// something else create a new camera).
+///
+/// Unlike vk2dCameraUpdate this takes effect immediately: sprites batched so
+/// far are flushed with the old camera and everything drawn after the call
+/// this frame uses the new one, so a frame can draw world-space and
+/// screen-space passes under different cameras.
 void vk2dRendererSetCamera(VK2DCameraSpec camera);
 
 /// \brief Returns the camera spec of the default camera, this is equivalent to
@@ -432,6 +437,19 @@ void vk2dRendererDrawGeometry(VK2DVertexColour *vertices, int count, float x,
                               float xscale, float yscale, float rot,
                               float originX, float originY);
 
+/// \brief Draws every instance in an instance buffer with a single draw call
+/// \param instanceBuffer Instance buffer to draw
+/// \param x X offset added to every instance after scaling
+/// \param y Y offset added to every instance after scaling
+/// \param scale Scale applied to the buffer's positions and sizes
+///
+/// Instances are drawn as if each of their commands went through
+/// vk2dRendererAddBatch at (pos * scale + (x, y)) with its scale multiplied by
+/// scale. If the buffer was updated since it was last drawn its commands are
+/// processed again first, which applies to the whole frame.
+void vk2dRendererDrawInstanceBuffer(VK2DInstanceBuffer instanceBuffer, float x,
+                                    float y, float scale);
+
 /// \brief Draws a shadow environment
 /// \param shadowEnvironment Shadows to draw
 /// \param colour Colour of the shadows
@@ -32,6 +32,11 @@ void _vk2dCameraUpdateUBO(VK2DUniformBufferObject *ubo, VK2DCameraSpec *camera,
 // swapchain buffer to flush
 void _vk2dRendererFlushUBOBuffers();
 
+// Rebuilds the camera matrices into a fresh UBO set mid-frame so later draws
+// see camera changes while earlier ones keep the matrices they were recorded
+// with; does nothing outside a frame
+void _vk2dRendererRefreshCameras();
+
 // Grabs a preferred present mode if available returning FIFO if its unavailable
 VkPresentModeKHR _vk2dRendererGetPresentMode(VkPresentModeKHR mode);
 
@@ -98,6 +103,11 @@ void _vk2dRendererResetSwapchain();
 // Adds a copy of a given draw command for each active camera
 void _vk2dRendererAddDrawCommand(VK2DDrawCommand *command);
 
+// Appends count draw commands with a single copy; the caller makes sure they
+// fit in the current batch
+void _vk2dRendererAddDrawCommands(const VK2DDrawCommand *commands,
+                                  uint32_t count);
+
 // Resets current batch information
 void _vk2dRendererResetBatch();
 
@@ -105,6 +115,19 @@ void _vk2dRendererResetBatch();
 // current draw command
 void _vk2dRendererFlushBatchIfNeeded(VK2DPipeline pipe);
 
+// Records the compute pass that turns an instance buffer's commands into
+// instances, must be called mid-frame
+void _vk2dRendererUploadInstanceBuffer(VK2DInstanceBuffer instanceBuffer);
+
+// Fills ubo with the view projections a sprite batch uses for the current
+// target
+void _vk2dRendererGetBatchUBO(VK2DUniformBufferObject *ubo);
+
+// Copies the current view projections, with a scale and translation applied
+// first, to this frame's descriptor buffer and returns a set for them
+VkDescriptorSet _vk2dRendererGetTransformedUBOSet(float x, float y,
+                                                  float scale);
+
 void _vk2dRendererDrawRaw(VkDescriptorSet *sets, uint32_t setCount,
                           VK2DPolygon poly, VK2DPipeline pipe, float x, float y,
                           float xscale, float yscale, float rot, float originX,
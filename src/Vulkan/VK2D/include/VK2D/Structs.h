@@ -210,6 +210,7 @@ VK2D_OPAQUE_POINTER(VK2DShader)
 VK2D_OPAQUE_POINTER(VK2DModel)
 VK2D_OPAQUE_POINTER(VK2DDescriptorBuffer)
 VK2D_OPAQUE_POINTER(VK2DShadowEnvironment)
+VK2D_OPAQUE_POINTER(VK2DInstanceBuffer)
 VK2D_OPAQUE_POINTER(VK2DGui)
 
 /// \brief 2D vector of floats
@@ -383,6 +384,10 @@ struct VK2DRendererLimits {
   bool supportsVRAMUsage; ///< Whether or not the host supports accurate VRAM
                           ///< usage, if this is false VMA will provide a less
                           ///< accurate estimate
+  bool supportsMultiDrawIndirect; ///< Whether or not sprite batches are culled
+                                  ///< per camera on the GPU and drawn with one
+                                  ///< indirect draw per camera, if this is
+                                  ///< false batches are drawn unculled
 };
 
 /// \brief Represents the data you need for each element in an instanced draw
@@ -417,6 +422,13 @@ struct VK2DComputePushBuffer {
   uint32_t drawCount; ///< Number of draws being processed in this compute pass
 };
 
+/// \brief Push buffer for the sprite batch culling compute shader
+struct VK2DCullPushBuffer {
+  mat4 viewproj;      ///< View projection of the camera being culled against
+  uint32_t drawCount; ///< Number of instances being culled
+  vec3 padding;       ///< Padding
+};
+
 /// \brief Info for the shadow environment to keep track of
 struct VK2DShadowObjectInfo {
   bool enabled;       ///< Whether or not this object is enabled
@@ -514,6 +526,7 @@ VK2D_USER_STRUCT(VK2DAssetLoad)
 VK2D_USER_STRUCT(VK2DShadowObjectInfo)
 VK2D_USER_STRUCT(VK2DInstancedPushBuffer)
 VK2D_USER_STRUCT(VK2DComputePushBuffer)
+VK2D_USER_STRUCT(VK2DCullPushBuffer)
 VK2D_USER_STRUCT(VK2DLogger)
 
 #ifdef __cplusplus
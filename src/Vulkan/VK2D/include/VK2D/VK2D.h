@@ -7,6 +7,7 @@
 #include "VK2D/Camera.h"
 #include "VK2D/Gui.h"
 #include "VK2D/Image.h"
+#include "VK2D/InstanceBuffer.h"
 #include "VK2D/Model.h"
 #include "VK2D/Polygon.h"
 #include "VK2D/Renderer.h"
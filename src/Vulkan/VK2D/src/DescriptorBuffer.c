@@ -48,7 +48,8 @@ _vk2dDescriptorBufferAppendBuffer(VK2DDescriptorBuffer db) {
       db->dev, db->pageSize,
       VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT |
           VK_BUFFER_USAGE_VERTEX_BUFFER_BIT |
-          VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+          VK_BUFFER_USAGE_STORAGE_BUFFER_BIT |
+          VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT,
       VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
 
   if (buffer->stageBuffer == NULL || buffer->deviceBuffer == NULL) {
@@ -288,7 +289,9 @@ void vk2dDescriptorBufferRecordComputePipelineBarrier(VK2DDescriptorBuffer db,
       db->memoryBarriers[i].sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
       db->memoryBarriers[i].pNext = VK_NULL_HANDLE;
       db->memoryBarriers[i].srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
-      db->memoryBarriers[i].dstAccessMask = VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT;
+      db->memoryBarriers[i].dstAccessMask =
+          VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_SHADER_READ_BIT |
+          VK_ACCESS_INDIRECT_COMMAND_READ_BIT;
       db->memoryBarriers[i].srcQueueFamilyIndex =
           gRenderer->pd->QueueFamily.graphicsFamily;
       db->memoryBarriers[i].dstQueueFamilyIndex =
@@ -302,7 +305,11 @@ void vk2dDescriptorBufferRecordComputePipelineBarrier(VK2DDescriptorBuffer db,
     }
   }
 
+  // Culled batches read their draw counts from here as well
   vkCmdPipelineBarrier(buf, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
-                       VK_PIPELINE_STAGE_VERTEX_INPUT_BIT, 0, 0, VK_NULL_HANDLE,
-                       barrierCount, db->memoryBarriers, 0, VK_NULL_HANDLE);
+                       VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT |
+                           VK_PIPELINE_STAGE_VERTEX_INPUT_BIT |
+                           VK_PIPELINE_STAGE_VERTEX_SHADER_BIT,
+                       0, 0, VK_NULL_HANDLE, barrierCount, db->memoryBarriers,
+                       0, VK_NULL_HANDLE);
 }
@@ -0,0 +1,93 @@
+// File: src/Vulkan/VK2D/src/InstanceBuffer.c
+// / \file InstanceBuffer.c
+
+#include "VK2D/InstanceBuffer.h"
+#include "VK2D/Buffer.h"
+#include "VK2D/Logger.h"
+#include "VK2D/Opaque.h"
+#include "VK2D/Renderer.h"
+#include "VK2D/Validation.h"
+#include <stdlib.h>
+#include <string.h>
+
+static VK2DBuffer _vk2dInstanceBufferCreateVRAM(uint32_t capacity) {
+  return vk2dBufferCreate(vk2dRendererGetDevice(),
+                          capacity * sizeof(struct VK2DDrawInstance),
+                          VK_BUFFER_USAGE_STORAGE_BUFFER_BIT |
+                              VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+                          VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+}
+
+VK2DInstanceBuffer vk2dInstanceBufferCreate(uint32_t capacity) {
+  if (vk2dRendererGetPointer() == NULL || vk2dStatusFatal())
+    return NULL;
+
+  VK2DInstanceBuffer ib = calloc(1, sizeof(struct VK2DInstanceBuffer_t));
+  if (ib == NULL) {
+    vk2dRaise(VK2D_STATUS_OUT_OF_RAM, "Failed to allocate instance buffer.");
+    return NULL;
+  }
+
+  ib->capacity = capacity > 0 ? capacity : 1;
+  ib->instances = _vk2dInstanceBufferCreateVRAM(ib->capacity);
+  if (ib->instances == NULL) {
+    free(ib);
+    return NULL;
+  }
+
+  return ib;
+}
+
+void vk2dInstanceBufferFree(VK2DInstanceBuffer instanceBuffer) {
+  if (instanceBuffer != NULL) {
+    vk2dRendererWait();
+    vk2dBufferFree(instanceBuffer->instances);
+    free(instanceBuffer->commands);
+    free(instanceBuffer);
+  }
+}
+
+void vk2dInstanceBufferUpdate(VK2DInstanceBuffer instanceBuffer,
+                              const VK2DDrawCommand *commands, uint32_t count) {
+  if (instanceBuffer == NULL || vk2dStatusFatal())
+    return;
+
+  // Host copy of the commands, processed into instances at the next draw
+  if (count > instanceBuffer->commandsSize) {
+    VK2DDrawCommand *newCommands =
+        realloc(instanceBuffer->commands, count * sizeof(VK2DDrawCommand));
+    if (newCommands == NULL) {
+      vk2dRaise(VK2D_STATUS_OUT_OF_RAM,
+                "Failed to allocate %i instance buffer commands.", count);
+      return;
+    }
+    instanceBuffer->commands = newCommands;
+    instanceBuffer->commandsSize = count;
+  }
+
+  // Growing the vram buffer; frames in flight may still be reading the old one
+  if (count > instanceBuffer->capacity) {
+    vk2dRendererWait();
+    vk2dBufferFree(instanceBuffer->instances);
+    instanceBuffer->capacity = count;
+    instanceBuffer->instances = _vk2dInstanceBufferCreateVRAM(count);
+    if (instanceBuffer->instances == NULL) {
+      instanceBuffer->capacity = 0;
+      instanceBuffer->count = 0;
+      return;
+    }
+  }
+
+  if (count > 0)
+    memcpy(instanceBuffer->commands, commands, count * sizeof(VK2DDrawCommand));
+  instanceBuffer->count = count;
+  instanceBuffer->dirty = true;
+}
+
+uint32_t vk2dInstanceBufferGetCount(VK2DInstanceBuffer instanceBuffer) {
+  return instanceBuffer != NULL ? instanceBuffer->count : 0;
+}
+
+uint32_t vk2dInstanceBufferGetCapacity(VK2DInstanceBuffer instanceBuffer) {
+  return instanceBuffer != NULL ? instanceBuffer->capacity : 0;
+}
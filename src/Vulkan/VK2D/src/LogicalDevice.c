@@ -68,7 +68,9 @@ VK2DLogicalDevice vk2dLogicalDeviceCreate(VK2DPhysicalDevice dev,
       } else {
         limits->maxMSAA = 1;
       }
+      feats.multiDrawIndirect = dev->feats.multiDrawIndirect;
     }
+    limits->supportsMultiDrawIndirect = feats.multiDrawIndirect == VK_TRUE;
 
     // For dynamic descriptor arrays
     VkPhysicalDeviceDescriptorIndexingFeatures indexingFeatures = {
@@ -4,6 +4,7 @@
 #include <SDL3/SDL_vulkan.h>
 #include <math.h>
 #include <stdio.h>
+#include <string.h>
 #include <time.h>
 #include <vulkan/vulkan.h>
 
@@ -442,10 +443,10 @@ void vk2dRendererStartFrame(const vec4 clearColour) {
       gRenderer->targetSubPass = 0;
       gRenderer->targetImage =
           gRenderer->swapchainImages[gRenderer->scImageIndex];
-      gRenderer->targetUBOSet =
-          gRenderer
-              ->uboDescriptorSets[gRenderer->currentFrame]; // TODO: Should prob
-                                                            // be reworked
+      gRenderer->frameUBOSet =
+          gRenderer->uboDescriptorSets[gRenderer->currentFrame];
+      gRenderer->targetUBOSet = gRenderer->frameUBOSet; // TODO: Should prob
+                                                        // be reworked
       gRenderer->target = VK2D_TARGET_SCREEN;
       _vk2dRendererResetBatch();
 
@@ -495,7 +496,9 @@ void vk2dRendererStartFrame(const vec4 clearColour) {
       // Desc cons
       vk2dDescConReset(gRenderer->descConShaders[gRenderer->currentFrame]);
       vk2dDescConReset(gRenderer->descConCompute[gRenderer->currentFrame]);
+      vk2dDescConReset(gRenderer->descConCull[gRenderer->currentFrame]);
       vk2dDescConReset(gRenderer->descConSBO[gRenderer->currentFrame]);
+      vk2dDescConReset(gRenderer->descConVPFrame[gRenderer->currentFrame]);
 
       // Setup render pass
       VkRect2D rect = {0};
@@ -691,9 +694,8 @@ void vk2dRendererSetTarget(VK2DTexture target) {
                           ? gRenderer->swapchainImages[gRenderer->scImageIndex]
                           : target->img->img;
       VkDescriptorSet buffer =
-          target == VK2D_TARGET_SCREEN
-              ? gRenderer->uboDescriptorSets[gRenderer->currentFrame]
-              : target->uboSet;
+          target == VK2D_TARGET_SCREEN ? gRenderer->frameUBOSet
+                                       : target->uboSet;
 
       vkCmdEndRenderPass(gRenderer->commandBuffer[gRenderer->scImageIndex]);
 
@@ -766,6 +768,7 @@ VK2DBlendMode vk2dRendererGetBlendMode() {
 
 void vk2dRendererSetCamera(VK2DCameraSpec camera) {
   if (vk2dRendererGetPointer() != NULL) {
+    vk2dRendererFlushSpriteBatch();
     gRenderer->cameras[VK2D_DEFAULT_CAMERA].spec = camera;
     gRenderer->cameras[VK2D_DEFAULT_CAMERA].spec.wOnScreen =
         gRenderer->surfaceWidth;
@@ -773,6 +776,7 @@ void vk2dRendererSetCamera(VK2DCameraSpec camera) {
         gRenderer->surfaceHeight;
     gRenderer->cameras[VK2D_DEFAULT_CAMERA].spec.xOnScreen = 0;
     gRenderer->cameras[VK2D_DEFAULT_CAMERA].spec.yOnScreen = 0;
+    _vk2dRendererRefreshCameras();
   }
 }
 
@@ -811,7 +815,7 @@ void vk2dRendererClear() {
   if (vk2dRendererGetPointer() != NULL && !vk2dStatusFatal()) {
     vk2dRendererFlushSpriteBatch();
 
-    VkDescriptorSet set = gRenderer->uboDescriptorSets[gRenderer->currentFrame];
+    VkDescriptorSet set = gRenderer->frameUBOSet;
     _vk2dRendererDrawRaw(&set, 1, gRenderer->unitSquare,
                          gRenderer->primFillPipe, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0,
                          0, 0, VK2D_INVALID_CAMERA);
@@ -939,9 +943,18 @@ void vk2dRendererDrawShader(VK2DShader shader, void *data, VK2DTexture tex,
 void vk2dRendererAddBatch(VK2DDrawCommand *commands, uint32_t count) {
   if (vk2dRendererGetPointer() != NULL && !vk2dStatusFatal()) {
     const VK2DPipeline pipe = gRenderer->instancedPipe;
-    for (int i = 0; i < count; i++) {
+    uint32_t submitted = 0;
+
+    // One flush check and one copy per chunk that fits in the current batch
+    while (submitted < count && !vk2dStatusFatal()) {
       _vk2dRendererFlushBatchIfNeeded(pipe);
-      _vk2dRendererAddDrawCommand(&commands[i]);
+      const uint64_t space = gRenderer->limits.maxInstancedDraws -
+                             (uint64_t)gRenderer->drawCommandCount;
+      const uint32_t remaining = count - submitted;
+      const uint32_t chunk =
+          remaining < space ? remaining : (uint32_t)space;
+      _vk2dRendererAddDrawCommands(&commands[submitted], chunk);
+      submitted += chunk;
     }
   }
 }
@@ -1087,7 +1100,9 @@ void vk2dRendererDrawWireframe(VK2DModel model, float x, float y, float z,
   }
 }
 
-static void _vk2dRendererFlushPerCamera(VkCommandBuffer buf, int cameraIndex) {
+// Sets the viewport, scissor and camera push constant for one camera's draw
+static void _vk2dRendererSetCameraViewport(VkCommandBuffer buf,
+                                           int cameraIndex) {
   // Viewport/scissor
   const int cam = cameraIndex; // TODO: Fix this
   VK2DInstancedPushBuffer push = {.cameraIndex = cameraIndex};
@@ -1118,10 +1133,119 @@ static void _vk2dRendererFlushPerCamera(VkCommandBuffer buf, int cameraIndex) {
   }
   vkCmdSetViewport(buf, 0, 1, &viewport);
   vkCmdSetScissor(buf, 0, 1, &scissor);
-  vkCmdPushConstants(buf, gRenderer->currentBatchPipeline->layout,
+  vkCmdPushConstants(buf, gRenderer->instancedPipe->layout,
                      VK_SHADER_STAGE_VERTEX_BIT, 0,
                      sizeof(struct VK2DInstancedPushBuffer), &push);
-  vkCmdDraw(buf, 6 * gRenderer->drawCommandCount, 1, 0, 0);
+}
+
+// Whether instanced draws go to a camera: every active 2D camera, or only
+// camera 0 for a texture target without the camera UBO
+static bool _vk2dRendererDrawsToCamera(int cameraIndex) {
+  if (gRenderer->target != VK2D_TARGET_SCREEN &&
+      !gRenderer->enableTextureCameraUBO)
+    return cameraIndex == 0;
+  return gRenderer->cameras[cameraIndex].state == VK2D_CAMERA_STATE_NORMAL &&
+         gRenderer->cameras[cameraIndex].spec.type ==
+             VK2D_CAMERA_TYPE_DEFAULT &&
+         (cameraIndex == gRenderer->cameraLocked ||
+          gRenderer->cameraLocked == VK2D_INVALID_CAMERA);
+}
+
+// Issues the instanced draw once per camera it goes to
+static void _vk2dRendererDrawPerCamera(VkCommandBuffer buf,
+                                       uint32_t drawCount) {
+  for (int i = 0; i < VK2D_MAX_CAMERAS; i++) {
+    if (_vk2dRendererDrawsToCamera(i)) {
+      _vk2dRendererSetCameraViewport(buf, i);
+      vkCmdDraw(buf, 6 * drawCount, 1, 0, 0);
+    }
+  }
+}
+
+// Where a camera's culled instances and indirect draws ended up
+typedef struct {
+  VkDescriptorSet sboSet;
+  VkBuffer indirect;
+  VkDeviceSize indirectOffset;
+} _VK2DCulledBatch;
+
+// Records the cull pass for one camera; every group of 64 instances leaves
+// its visible ones, in order, at the front of its slots in the output and
+// writes one indirect draw for them
+static void _vk2dRendererCullForCamera(VkCommandBuffer computeBuf,
+                                       const mat4 viewproj,
+                                       VkBuffer drawInstances,
+                                       VkDeviceSize drawInstancesOffset,
+                                       uint32_t drawCount,
+                                       _VK2DCulledBatch *culled) {
+  const uint32_t groups = (drawCount + 63) / 64;
+  VkBuffer culledInstances;
+  VkDeviceSize culledInstancesOffset;
+  vk2dDescriptorBufferReserveSpace(
+      gRenderer->descriptorBuffers[gRenderer->currentFrame],
+      groups * 64 * sizeof(VK2DDrawInstance), &culledInstances,
+      &culledInstancesOffset);
+  vk2dDescriptorBufferReserveSpace(
+      gRenderer->descriptorBuffers[gRenderer->currentFrame],
+      groups * sizeof(VkDrawIndirectCommand), &culled->indirect,
+      &culled->indirectOffset);
+
+  VkDescriptorSet cullSet =
+      vk2dDescConGetSet(gRenderer->descConCull[gRenderer->currentFrame]);
+  culled->sboSet =
+      vk2dDescConGetSet(gRenderer->descConSBO[gRenderer->currentFrame]);
+  VkDescriptorBufferInfo bufferInfos[3] = {
+      {.buffer = drawInstances,
+       .offset = drawInstancesOffset,
+       .range = drawCount * sizeof(struct VK2DDrawInstance)},
+      {.buffer = culledInstances,
+       .offset = culledInstancesOffset,
+       .range = groups * 64 * sizeof(struct VK2DDrawInstance)},
+      {.buffer = culled->indirect,
+       .offset = culled->indirectOffset,
+       .range = groups * sizeof(VkDrawIndirectCommand)}};
+  VkWriteDescriptorSet writes[] = {
+      {.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+       .dstSet = cullSet,
+       .dstBinding = 0,
+       .descriptorCount = 3,
+       .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+       .pBufferInfo = bufferInfos},
+      {.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+       .dstSet = culled->sboSet,
+       .dstBinding = 3,
+       .descriptorCount = 1,
+       .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+       .pBufferInfo = &bufferInfos[1]}};
+  vkUpdateDescriptorSets(gRenderer->ld->dev, 2, writes, 0, VK_NULL_HANDLE);
+
+  VK2DCullPushBuffer push = {.drawCount = drawCount};
+  memcpy(push.viewproj, viewproj, sizeof(mat4));
+  vkCmdPushConstants(computeBuf, gRenderer->spriteCullPipe->layout,
+                     VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(VK2DCullPushBuffer),
+                     &push);
+  vkCmdBindDescriptorSets(computeBuf, VK_PIPELINE_BIND_POINT_COMPUTE,
+                          gRenderer->spriteCullPipe->layout, 0, 1, &cullSet, 0,
+                          VK_NULL_HANDLE);
+  vkCmdDispatch(computeBuf, groups, 1, 1);
+}
+
+// Draws a camera's culled instances, one indirect draw per group of 64, in as
+// few multi-draws as maxDrawIndirectCount allows. Only used with
+// multiDrawIndirect; without it the batch is drawn unculled instead
+static void _vk2dRendererDrawCulled(VkCommandBuffer buf,
+                                    const _VK2DCulledBatch *culled,
+                                    uint32_t drawCount) {
+  const uint32_t groups = (drawCount + 63) / 64;
+  const uint32_t maxDraws = gRenderer->pd->props.limits.maxDrawIndirectCount;
+  for (uint32_t group = 0; group < groups; group += maxDraws) {
+    const uint32_t count =
+        groups - group < maxDraws ? groups - group : maxDraws;
+    vkCmdDrawIndirect(buf, culled->indirect,
+                      culled->indirectOffset +
+                          group * sizeof(VkDrawIndirectCommand),
+                      count, sizeof(VkDrawIndirectCommand));
+  }
 }
 
 void vk2dRendererFlushSpriteBatch() {
@@ -1129,8 +1253,13 @@ void vk2dRendererFlushSpriteBatch() {
   //  1. Copies the current sprite batch to the descriptor buffer
   //  2. Reserves space on the descriptor buffer for the compute output
   //  3. Dispatch the compute shader on the compute command buffer
-  //  4. Send out the draw command that uses the soon-to-be-filled compute
+  //  4. Dispatch the cull shader once per camera, compacting each camera's
+  //  visible instances and writing their indirect draws
+  //  5. Send out the indirect draws that use the soon-to-be-filled cull
   //  output as vertex input
+  // Without multiDrawIndirect every group of 64 would need its own indirect
+  // draw, so steps 4 and 5 are replaced by one plain draw per camera of the
+  // unculled instances
   if (gRenderer->currentBatchPipeline != NULL &&
       gRenderer->drawCommandCount > 0) {
     // Copy the draw commands into a buffer
@@ -1152,8 +1281,6 @@ void vk2dRendererFlushSpriteBatch() {
     const uint32_t drawCount = gRenderer->drawCommandCount;
     VkDescriptorSet descriptorSet =
         vk2dDescConGetSet(gRenderer->descConCompute[gRenderer->currentFrame]);
-    VkDescriptorSet vertexShaderSBOSet =
-        vk2dDescConGetSet(gRenderer->descConSBO[gRenderer->currentFrame]);
     VkDescriptorBufferInfo bufferInfos[2] = {
         {.buffer = drawCommands,
          .offset = drawCommandsOffset,
@@ -1161,20 +1288,14 @@ void vk2dRendererFlushSpriteBatch() {
         {.buffer = drawInstances,
          .offset = drawInstancesOffset,
          .range = drawCount * sizeof(struct VK2DDrawInstance)}};
-    VkWriteDescriptorSet writes[] = {
-        {.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
-         .dstSet = descriptorSet,
-         .dstBinding = 0,
-         .descriptorCount = 2,
-         .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
-         .pBufferInfo = bufferInfos},
-        {.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
-         .dstSet = vertexShaderSBOSet,
-         .dstBinding = 3,
-         .descriptorCount = 1,
-         .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
-         .pBufferInfo = &bufferInfos[1]}};
-    vkUpdateDescriptorSets(gRenderer->ld->dev, 2, writes, 0, VK_NULL_HANDLE);
+    VkWriteDescriptorSet write = {
+        .sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+        .dstSet = descriptorSet,
+        .dstBinding = 0,
+        .descriptorCount = 2,
+        .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+        .pBufferInfo = bufferInfos};
+    vkUpdateDescriptorSets(gRenderer->ld->dev, 1, &write, 0, VK_NULL_HANDLE);
 
     // Queue compute dispatches to the compute command buffer, synchronization
     // will be recorded at the end of the frame
@@ -1189,7 +1310,33 @@ void vk2dRendererFlushSpriteBatch() {
                             &descriptorSet, 0, VK_NULL_HANDLE);
     vkCmdDispatch(computeBuf, (drawCount / 64) + 1, 1, 1);
 
-    // Dispatch compute and draw command
+    // Cull once per camera, then put the sprite batch pipeline back for the
+    // next flush or instance buffer upload
+    const bool cull = gRenderer->limits.supportsMultiDrawIndirect;
+    _VK2DCulledBatch culled[VK2D_MAX_CAMERAS];
+    if (cull) {
+      // The cull passes read the instances just written
+      VkMemoryBarrier barrier = {.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+                                 .srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT,
+                                 .dstAccessMask = VK_ACCESS_SHADER_READ_BIT};
+      vkCmdPipelineBarrier(computeBuf, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                           VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 1, &barrier,
+                           0, VK_NULL_HANDLE, 0, VK_NULL_HANDLE);
+
+      VK2DUniformBufferObject ubo;
+      _vk2dRendererGetBatchUBO(&ubo);
+      vkCmdBindPipeline(computeBuf, VK_PIPELINE_BIND_POINT_COMPUTE,
+                        vk2dPipelineGetCompute(gRenderer->spriteCullPipe));
+      for (int i = 0; i < VK2D_MAX_CAMERAS; i++)
+        if (_vk2dRendererDrawsToCamera(i))
+          _vk2dRendererCullForCamera(computeBuf, ubo.viewproj[i],
+                                     drawInstances, drawInstancesOffset,
+                                     drawCount, &culled[i]);
+      vkCmdBindPipeline(computeBuf, VK_PIPELINE_BIND_POINT_COMPUTE,
+                        vk2dPipelineGetCompute(gRenderer->spriteBatchPipe));
+    }
+
+    // Draw command
     VkCommandBuffer buf = gRenderer->commandBuffer[gRenderer->scImageIndex];
     _vk2dRendererResetBoundPointers();
     vkCmdBindPipeline(
@@ -1198,30 +1345,43 @@ void vk2dRendererFlushSpriteBatch() {
     VkDescriptorSet sets[] = {
         gRenderer->target != NULL && !gRenderer->enableTextureCameraUBO
             ? gRenderer->targetUBOSet
-            : gRenderer->uboDescriptorSets[gRenderer->currentFrame],
-        gRenderer->samplerSet, gRenderer->texArrayDescriptorSet,
-        vertexShaderSBOSet};
+            : gRenderer->frameUBOSet,
+        gRenderer->samplerSet, gRenderer->texArrayDescriptorSet};
     // These things are the same across every camera, so they are only bound
     // once
     vkCmdBindDescriptorSets(buf, VK_PIPELINE_BIND_POINT_GRAPHICS,
-                            gRenderer->instancedPipe->layout, 0, 4, sets, 0,
+                            gRenderer->instancedPipe->layout, 0, 3, sets, 0,
                             VK_NULL_HANDLE);
     vkCmdSetLineWidth(buf, 1);
 
-    // Draw once per camera
-    if (gRenderer->target != VK2D_TARGET_SCREEN &&
-        !gRenderer->enableTextureCameraUBO) {
-      _vk2dRendererFlushPerCamera(buf, 0);
-    } else {
-      // Only render to 2D cameras
+    if (cull) {
+      // Draw once per camera from that camera's culled instances
       for (int i = 0; i < VK2D_MAX_CAMERAS; i++) {
-        if (gRenderer->cameras[i].state == VK2D_CAMERA_STATE_NORMAL &&
-            gRenderer->cameras[i].spec.type == VK2D_CAMERA_TYPE_DEFAULT &&
-            (i == gRenderer->cameraLocked ||
-             gRenderer->cameraLocked == VK2D_INVALID_CAMERA)) {
-          _vk2dRendererFlushPerCamera(buf, i);
+        if (_vk2dRendererDrawsToCamera(i)) {
+          vkCmdBindDescriptorSets(buf, VK_PIPELINE_BIND_POINT_GRAPHICS,
+                                  gRenderer->instancedPipe->layout, 3, 1,
+                                  &culled[i].sboSet, 0, VK_NULL_HANDLE);
+          _vk2dRendererSetCameraViewport(buf, i);
+          _vk2dRendererDrawCulled(buf, &culled[i], drawCount);
         }
       }
+    } else {
+      // Every camera draws the whole batch straight from the compute output
+      VkDescriptorSet vertexShaderSBOSet =
+          vk2dDescConGetSet(gRenderer->descConSBO[gRenderer->currentFrame]);
+      VkWriteDescriptorSet sboWrite = {
+          .sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+          .dstSet = vertexShaderSBOSet,
+          .dstBinding = 3,
+          .descriptorCount = 1,
+          .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+          .pBufferInfo = &bufferInfos[1]};
+      vkUpdateDescriptorSets(gRenderer->ld->dev, 1, &sboWrite, 0,
+                             VK_NULL_HANDLE);
+      vkCmdBindDescriptorSets(buf, VK_PIPELINE_BIND_POINT_GRAPHICS,
+                              gRenderer->instancedPipe->layout, 3, 1,
+                              &vertexShaderSBOSet, 0, VK_NULL_HANDLE);
+      _vk2dRendererDrawPerCamera(buf, drawCount);
     }
 
     // Reset the current batch
@@ -1231,6 +1391,58 @@ void vk2dRendererFlushSpriteBatch() {
   }
 }
 
+void vk2dRendererDrawInstanceBuffer(VK2DInstanceBuffer instanceBuffer, float x,
+                                    float y, float scale) {
+  if (vk2dRendererGetPointer() != NULL && !vk2dStatusFatal()) {
+    if (instanceBuffer == NULL) {
+      vk2dRaise(VK2D_STATUS_BAD_ASSET, "Instance buffer does not exist.");
+      return;
+    }
+    if (instanceBuffer->count == 0)
+      return;
+
+    // Keep draw order with anything batched before this
+    vk2dRendererFlushSpriteBatch();
+
+    if (instanceBuffer->dirty)
+      _vk2dRendererUploadInstanceBuffer(instanceBuffer);
+
+    // Same pipeline and sets as a sprite batch flush, except the view
+    // projection carries the buffer's transform and the instances come from
+    // the persistent buffer
+    VkDescriptorSet vertexShaderSBOSet =
+        vk2dDescConGetSet(gRenderer->descConSBO[gRenderer->currentFrame]);
+    VkDescriptorBufferInfo bufferInfo = {
+        .buffer = instanceBuffer->instances->buf,
+        .offset = 0,
+        .range = instanceBuffer->count * sizeof(struct VK2DDrawInstance)};
+    VkWriteDescriptorSet write = {
+        .sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+        .dstSet = vertexShaderSBOSet,
+        .dstBinding = 3,
+        .descriptorCount = 1,
+        .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+        .pBufferInfo = &bufferInfo};
+    vkUpdateDescriptorSets(gRenderer->ld->dev, 1, &write, 0, VK_NULL_HANDLE);
+
+    VkCommandBuffer buf = gRenderer->commandBuffer[gRenderer->scImageIndex];
+    _vk2dRendererResetBoundPointers();
+    vkCmdBindPipeline(
+        buf, VK_PIPELINE_BIND_POINT_GRAPHICS,
+        vk2dPipelineGetPipe(gRenderer->instancedPipe, gRenderer->blendMode));
+    VkDescriptorSet sets[] = {_vk2dRendererGetTransformedUBOSet(x, y, scale),
+                              gRenderer->samplerSet,
+                              gRenderer->texArrayDescriptorSet,
+                              vertexShaderSBOSet};
+    vkCmdBindDescriptorSets(buf, VK_PIPELINE_BIND_POINT_GRAPHICS,
+                            gRenderer->instancedPipe->layout, 0, 4, sets, 0,
+                            VK_NULL_HANDLE);
+    vkCmdSetLineWidth(buf, 1);
+
+    _vk2dRendererDrawPerCamera(buf, instanceBuffer->count);
+  }
+}
+
 static inline float _getHexValue(char c) {
   switch (c) {
   case '1':
@@ -276,10 +276,28 @@ void _vk2dRendererFlushUBOBuffers() {
   write.descriptorCount = 1;
   write.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
   write.pBufferInfo = &bufferInfo;
-  write.dstSet = gRenderer->uboDescriptorSets[gRenderer->currentFrame];
+  write.dstSet = gRenderer->frameUBOSet;
   vkUpdateDescriptorSets(gRenderer->ld->dev, 1, &write, 0, VK_NULL_HANDLE);
 }
 
+void _vk2dRendererRefreshCameras() {
+  VK2DRenderer gRenderer = vk2dRendererGetPointer();
+  if (vk2dStatusFatal() || !gRenderer->procedStartFrame)
+    return;
+
+  for (int i = 0; i < VK2D_MAX_CAMERAS; i++)
+    if (gRenderer->cameras[i].state == VK2D_CAMERA_STATE_NORMAL)
+      _vk2dCameraUpdateUBO(&gRenderer->workingUBO, &gRenderer->cameras[i].spec,
+                           i);
+
+  // The old set is still referenced by commands already recorded this frame
+  gRenderer->frameUBOSet =
+      vk2dDescConGetSet(gRenderer->descConVPFrame[gRenderer->currentFrame]);
+  _vk2dRendererFlushUBOBuffers();
+  if (gRenderer->target == VK2D_TARGET_SCREEN)
+    gRenderer->targetUBOSet = gRenderer->frameUBOSet;
+}
+
 void _vk2dRendererCreateDebug() {
   VK2DRenderer gRenderer = vk2dRendererGetPointer();
   if (gRenderer->options.enableDebug && gRenderer != NULL) {
@@ -596,6 +614,10 @@ void _vk2dRendererCreateDescriptorBuffers() {
 
   gRenderer->limits.maxInstancedDraws =
       maxDrawCommands < maxDrawInstances ? maxDrawCommands : maxDrawInstances;
+
+  // Culling writes whole groups of 64 instances, which must fit in a page too
+  gRenderer->limits.maxInstancedDraws =
+      ((gRenderer->limits.maxInstancedDraws - 1) / 64) * 64;
   gRenderer->limits.maxInstancedDraws--;
 
   vk2dLogInfo("Descriptor buffers created...");
@@ -791,7 +813,7 @@ void _vk2dRendererCreateDescriptorSetLayouts() {
   VK2DRenderer gRenderer = vk2dRendererGetPointer();
   if (vk2dStatusFatal())
     return;
-  VkResult r1, r2, r3, r4, r5, r6, r7;
+  VkResult r1, r2, r3, r4, r5, r6, r7, r8;
 
   // For texture samplers
   const uint32_t layoutCount = 1;
@@ -891,6 +913,27 @@ void _vk2dRendererCreateDescriptorSetLayouts() {
   r6 = vkCreateDescriptorSetLayout(gRenderer->ld->dev, &dslComputeCreateInfo,
                                    VK_NULL_HANDLE, &gRenderer->dslSpriteBatch);
 
+  // DSL for culling, instances in and out plus the indirect commands
+  VkDescriptorSetLayoutBinding dslbCull[3] = {
+      {.descriptorCount = 1,
+       .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+       .stageFlags = VK_SHADER_STAGE_COMPUTE_BIT,
+       .binding = 0},
+      {.descriptorCount = 1,
+       .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+       .stageFlags = VK_SHADER_STAGE_COMPUTE_BIT,
+       .binding = 1},
+      {.descriptorCount = 1,
+       .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+       .stageFlags = VK_SHADER_STAGE_COMPUTE_BIT,
+       .binding = 2}};
+  VkDescriptorSetLayoutCreateInfo dslCullCreateInfo = {
+      .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO,
+      .pBindings = dslbCull,
+      .bindingCount = 3};
+  r8 = vkCreateDescriptorSetLayout(gRenderer->ld->dev, &dslCullCreateInfo,
+                                   VK_NULL_HANDLE, &gRenderer->dslSpriteCull);
+
   // For instanced vertex shader sbo shaders
   const uint32_t sboLayoutCount = 1;
   VkDescriptorSetLayoutBinding descriptorSetLayoutBindingSBO[1];
@@ -906,10 +949,11 @@ void _vk2dRendererCreateDescriptorSetLayouts() {
 
   if (r1 != VK_SUCCESS || r2 != VK_SUCCESS || r3 != VK_SUCCESS ||
       r4 != VK_SUCCESS || r5 != VK_SUCCESS || r6 != VK_SUCCESS ||
-      r7 != VK_SUCCESS) {
-    vk2dRaise(VK2D_STATUS_VULKAN_ERROR,
-              "Failed to create descriptor set layouts %i/%i/%i/%i/%i/%i/%i.",
-              r1, r2, r3, r4, r5, r6, r7);
+      r7 != VK_SUCCESS || r8 != VK_SUCCESS) {
+    vk2dRaise(
+        VK2D_STATUS_VULKAN_ERROR,
+        "Failed to create descriptor set layouts %i/%i/%i/%i/%i/%i/%i/%i.", r1,
+        r2, r3, r4, r5, r6, r7, r8);
     return;
   }
 
@@ -930,6 +974,8 @@ void _vk2dRendererDestroyDescriptorSetLayout() {
                                VK_NULL_HANDLE);
   vkDestroyDescriptorSetLayout(gRenderer->ld->dev, gRenderer->dslSpriteBatch,
                                VK_NULL_HANDLE);
+  vkDestroyDescriptorSetLayout(gRenderer->ld->dev, gRenderer->dslSpriteCull,
+                               VK_NULL_HANDLE);
   vkDestroyDescriptorSetLayout(gRenderer->ld->dev, gRenderer->dslBufferSBO,
                                VK_NULL_HANDLE);
 }
@@ -1025,6 +1071,9 @@ void _vk2dRendererCreatePipelines() {
   gRenderer->spriteBatchPipe = vk2dPipelineCreateCompute(
       gRenderer->ld, sizeof(VK2DComputePushBuffer), (void *)VK2DCompSpritebatch,
       sizeof(VK2DCompSpritebatch), &gRenderer->dslSpriteBatch, 1);
+  gRenderer->spriteCullPipe = vk2dPipelineCreateCompute(
+      gRenderer->ld, sizeof(VK2DCullPushBuffer), (void *)VK2DCompSpritecull,
+      sizeof(VK2DCompSpritecull), &gRenderer->dslSpriteCull, 1);
 
   // Shader pipelines
   for (i = 0; i < gRenderer->shaderListSize; i++) {
@@ -1048,6 +1097,7 @@ void _vk2dRendererDestroyPipelines(bool preserveCustomPipes) {
   vk2dPipelineFree(gRenderer->instancedPipe);
   vk2dPipelineFree(gRenderer->shadowsPipe);
   vk2dPipelineFree(gRenderer->spriteBatchPipe);
+  vk2dPipelineFree(gRenderer->spriteCullPipe);
 
   if (!preserveCustomPipes)
     free(gRenderer->customShaders);
@@ -1205,12 +1255,18 @@ void _vk2dRendererCreateDescriptorPool(bool preserveDescCons) {
       gRenderer->descConCompute[i] =
           vk2dDescConCreate(gRenderer->ld, gRenderer->dslSpriteBatch,
                             VK2D_NO_LOCATION, VK2D_NO_LOCATION, 0);
+      gRenderer->descConCull[i] =
+          vk2dDescConCreate(gRenderer->ld, gRenderer->dslSpriteCull,
+                            VK2D_NO_LOCATION, VK2D_NO_LOCATION, 0);
       gRenderer->descConShaders[i] =
           vk2dDescConCreate(gRenderer->ld, gRenderer->dslBufferUser, 3,
                             VK2D_NO_LOCATION, VK2D_NO_LOCATION);
       gRenderer->descConSBO[i] =
           vk2dDescConCreate(gRenderer->ld, gRenderer->dslBufferSBO,
                             VK2D_NO_LOCATION, VK2D_NO_LOCATION, 3);
+      gRenderer->descConVPFrame[i] =
+          vk2dDescConCreate(gRenderer->ld, gRenderer->dslBufferVP, 0,
+                            VK2D_NO_LOCATION, VK2D_NO_LOCATION);
     }
 
     // And the one sampler set
@@ -1312,8 +1368,10 @@ void _vk2dRendererDestroyDescriptorPool(bool preserveDescCons) {
     vk2dDescConFree(gRenderer->descConUser);
     for (int i = 0; i < VK2D_MAX_FRAMES_IN_FLIGHT; i++) {
       vk2dDescConFree(gRenderer->descConCompute[i]);
+      vk2dDescConFree(gRenderer->descConCull[i]);
       vk2dDescConFree(gRenderer->descConShaders[i]);
       vk2dDescConFree(gRenderer->descConSBO[i]);
+      vk2dDescConFree(gRenderer->descConVPFrame[i]);
     }
     vkDestroyDescriptorPool(gRenderer->ld->dev, gRenderer->samplerPool,
                             VK_NULL_HANDLE);
@@ -2167,7 +2225,7 @@ void _vk2dRendererDraw3D(VkDescriptorSet *sets, uint32_t setCount,
         gRenderer->cameras[i].spec.type != VK2D_CAMERA_TYPE_DEFAULT &&
         (i == gRenderer->cameraLocked ||
          gRenderer->cameraLocked == VK2D_INVALID_CAMERA)) {
-      sets[0] = gRenderer->uboDescriptorSets[gRenderer->currentFrame];
+      sets[0] = gRenderer->frameUBOSet;
       _vk2dRendererDrawRaw3D(sets, setCount, model, pipe, x, y, z, xscale,
                              yscale, zscale, rot, axis, originX, originY,
                              originZ, i, lineWidth);
@@ -2198,7 +2256,7 @@ void _vk2dRendererDraw(VkDescriptorSet *sets, uint32_t setCount,
           gRenderer->cameras[i].spec.type == VK2D_CAMERA_TYPE_DEFAULT &&
           (i == gRenderer->cameraLocked ||
            gRenderer->cameraLocked == VK2D_INVALID_CAMERA)) {
-        sets[0] = gRenderer->uboDescriptorSets[gRenderer->currentFrame];
+        sets[0] = gRenderer->frameUBOSet;
         _vk2dRendererDrawRaw(sets, setCount, poly, pipe, x, y, xscale, yscale,
                              rot, originX, originY, lineWidth, xInTex, yInTex,
                              texWidth, texHeight, i);
@@ -2229,7 +2287,7 @@ void _vk2dRendererDrawShader(VkDescriptorSet *sets, uint32_t setCount,
           gRenderer->cameras[i].spec.type == VK2D_CAMERA_TYPE_DEFAULT &&
           (i == gRenderer->cameraLocked ||
            gRenderer->cameraLocked == VK2D_INVALID_CAMERA)) {
-        sets[0] = gRenderer->uboDescriptorSets[gRenderer->currentFrame];
+        sets[0] = gRenderer->frameUBOSet;
         _vk2dRendererDrawRawShader(sets, setCount, tex, pipe, x, y, xscale,
                                    yscale, rot, originX, originY, lineWidth,
                                    xInTex, yInTex, texWidth, texHeight, i);
@@ -2261,7 +2319,7 @@ void _vk2dRendererDrawShadows(VK2DShadowEnvironment shadowEnvironment,
           gRenderer->cameras[i].spec.type == VK2D_CAMERA_TYPE_DEFAULT &&
           (i == gRenderer->cameraLocked ||
            gRenderer->cameraLocked == VK2D_INVALID_CAMERA)) {
-        set = gRenderer->uboDescriptorSets[gRenderer->currentFrame];
+        set = gRenderer->frameUBOSet;
         // Iterate through each shadow object
         for (int so = 0; so < shadowEnvironment->objectCount; so++) {
           if (shadowEnvironment->objectInfos[so].enabled)
@@ -2286,6 +2344,16 @@ void _vk2dRendererAddDrawCommand(VK2DDrawCommand *command) {
   _vk2dRendererAddDrawCommandInternal(command);
 }
 
+void _vk2dRendererAddDrawCommands(const VK2DDrawCommand *commands,
+                                  uint32_t count) {
+  VK2DRenderer gRenderer = vk2dRendererGetPointer();
+  if (vk2dStatusFatal() || count == 0)
+    return;
+  memcpy(&gRenderer->drawCommands[gRenderer->drawCommandCount], commands,
+         count * sizeof(struct VK2DDrawCommand));
+  gRenderer->drawCommandCount += count;
+}
+
 void _vk2dRendererResetBatch() {
   VK2DRenderer gRenderer = vk2dRendererGetPointer();
   gRenderer->currentBatchPipeline = NULL;
@@ -2299,7 +2367,128 @@ void _vk2dRendererFlushBatchIfNeeded(VK2DPipeline pipe) {
           gRenderer->currentBatchPipelineID ||
       gRenderer->drawCommandCount >= gRenderer->limits.maxInstancedDraws) {
     vk2dRendererFlushSpriteBatch();
-    gRenderer->currentBatchPipelineID = vk2dPipelineGetID(pipe, 0);
+    gRenderer->currentBatchPipelineID = vk2dPipelineGetID(pipe, gRenderer->blendMode);
     gRenderer->currentBatchPipeline = pipe;
   }
 }
+
+void _vk2dRendererUploadInstanceBuffer(VK2DInstanceBuffer instanceBuffer) {
+  VK2DRenderer gRenderer = vk2dRendererGetPointer();
+  const uint32_t count = instanceBuffer->count;
+
+  // Commands go through this frame's descriptor buffer like a sprite batch,
+  // but the compute shader writes the instances into the persistent buffer
+  VkBuffer drawCommands;
+  VkDeviceSize drawCommandsOffset;
+  vk2dDescriptorBufferCopyData(
+      gRenderer->descriptorBuffers[gRenderer->currentFrame],
+      instanceBuffer->commands, count * sizeof(struct VK2DDrawCommand),
+      &drawCommands, &drawCommandsOffset);
+
+  VkDescriptorSet descriptorSet =
+      vk2dDescConGetSet(gRenderer->descConCompute[gRenderer->currentFrame]);
+  VkDescriptorBufferInfo bufferInfos[2] = {
+      {.buffer = drawCommands,
+       .offset = drawCommandsOffset,
+       .range = count * sizeof(struct VK2DDrawCommand)},
+      {.buffer = instanceBuffer->instances->buf,
+       .offset = 0,
+       .range = count * sizeof(struct VK2DDrawInstance)}};
+  VkWriteDescriptorSet write = {
+      .sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+      .dstSet = descriptorSet,
+      .dstBinding = 0,
+      .descriptorCount = 2,
+      .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+      .pBufferInfo = bufferInfos};
+  vkUpdateDescriptorSets(gRenderer->ld->dev, 1, &write, 0, VK_NULL_HANDLE);
+
+  VkCommandBuffer computeBuf =
+      gRenderer->computeCommandBuffer[gRenderer->scImageIndex];
+
+  // Earlier frames may still be drawing the old instances
+  vkCmdPipelineBarrier(computeBuf,
+                       VK_PIPELINE_STAGE_VERTEX_INPUT_BIT |
+                           VK_PIPELINE_STAGE_VERTEX_SHADER_BIT,
+                       VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 0,
+                       VK_NULL_HANDLE, 0, VK_NULL_HANDLE, 0, VK_NULL_HANDLE);
+
+  VK2DComputePushBuffer push = {.drawCount = count};
+  vkCmdPushConstants(computeBuf, gRenderer->spriteBatchPipe->layout,
+                     VK_SHADER_STAGE_COMPUTE_BIT, 0,
+                     sizeof(VK2DComputePushBuffer), &push);
+  vkCmdBindDescriptorSets(computeBuf, VK_PIPELINE_BIND_POINT_COMPUTE,
+                          gRenderer->spriteBatchPipe->layout, 0, 1,
+                          &descriptorSet, 0, VK_NULL_HANDLE);
+  vkCmdDispatch(computeBuf, (count / 64) + 1, 1, 1);
+
+  // The descriptor buffer barrier at the end of the frame only covers the
+  // descriptor buffer, so this buffer gets its own
+  VkBufferMemoryBarrier barrier = {
+      .sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
+      .srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT,
+      .dstAccessMask =
+          VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT,
+      .srcQueueFamilyIndex = gRenderer->pd->QueueFamily.graphicsFamily,
+      .dstQueueFamilyIndex = gRenderer->pd->QueueFamily.graphicsFamily,
+      .buffer = instanceBuffer->instances->buf,
+      .offset = 0,
+      .size = count * sizeof(struct VK2DDrawInstance)};
+  vkCmdPipelineBarrier(computeBuf, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                       VK_PIPELINE_STAGE_VERTEX_INPUT_BIT |
+                           VK_PIPELINE_STAGE_VERTEX_SHADER_BIT,
+                       0, 0, VK_NULL_HANDLE, 1, &barrier, 0, VK_NULL_HANDLE);
+
+  instanceBuffer->dirty = false;
+}
+
+void _vk2dRendererGetBatchUBO(VK2DUniformBufferObject *ubo) {
+  VK2DRenderer gRenderer = vk2dRendererGetPointer();
+  if (gRenderer->target != VK2D_TARGET_SCREEN &&
+      !gRenderer->enableTextureCameraUBO) {
+    const float w = gRenderer->target->img->width;
+    const float h = gRenderer->target->img->height;
+    VK2DCameraSpec cam = {VK2D_CAMERA_TYPE_DEFAULT, 0, 0, w, h, 1, 0, 0, 0,
+                          w, h};
+    memset(ubo, 0, sizeof(VK2DUniformBufferObject));
+    _vk2dCameraUpdateUBO(ubo, &cam, 0);
+  } else {
+    *ubo = gRenderer->workingUBO;
+  }
+}
+
+VkDescriptorSet _vk2dRendererGetTransformedUBOSet(float x, float y,
+                                                  float scale) {
+  VK2DRenderer gRenderer = vk2dRendererGetPointer();
+
+  // Start from the matrices the sprite batch would use for the current target
+  VK2DUniformBufferObject ubo;
+  _vk2dRendererGetBatchUBO(&ubo);
+
+  // Scale then translate before each camera's view projection
+  vec3 translation = {x, y, 0};
+  vec3 scaling = {scale, scale, 1};
+  for (int i = 0; i < VK2D_MAX_CAMERAS; i++) {
+    translateMatrix(ubo.viewproj[i], translation);
+    scaleMatrix(ubo.viewproj[i], scaling);
+  }
+
+  VkBuffer buffer;
+  VkDeviceSize offset;
+  vk2dDescriptorBufferCopyData(
+      gRenderer->descriptorBuffers[gRenderer->currentFrame], &ubo,
+      sizeof(VK2DUniformBufferObject), &buffer, &offset);
+
+  VkDescriptorSet set =
+      vk2dDescConGetSet(gRenderer->descConVPFrame[gRenderer->currentFrame]);
+  VkDescriptorBufferInfo bufferInfo = {buffer, offset,
+                                       sizeof(VK2DUniformBufferObject)};
+  VkWriteDescriptorSet write = {0};
+  write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+  write.descriptorCount = 1;
+  write.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+  write.pBufferInfo = &bufferInfo;
+  write.dstSet = set;
+  vkUpdateDescriptorSets(gRenderer->ld->dev, 1, &write, 0, VK_NULL_HANDLE);
+  return set;
+}